@@ -0,0 +1,142 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// Keep value alive, so compiler can not remove computation of benchmark
+/// </summary>
+/// <typeparam name="V">type of value</typeparam>
+/// <param name="value">result of benchmark</param>
+template <class V>
+inline void doNotOptimize(const V& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const void* volatile sink{};
+    sink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/// <summary>
+/// Time of one benchmark
+/// </summary>
+struct BenchmarkResult {
+    std::string name;
+    std::string input;
+    size_t size;
+    size_t iterations;
+    double meanTime;
+    double minTime;
+};
+
+/// <summary>
+/// Small local benchmark harness. Body is called in rounds with doubling count of iterations
+/// until round takes min time, mean and min time of one iteration are reported in nanoseconds.
+/// Results are written in JSON with layout close to Google Benchmark.
+/// </summary>
+class BenchHarness {
+    public:
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="minTime">min time of measured round in seconds</param>
+        /// <param name="filter">only benchmarks whose name contains filter are run</param>
+        BenchHarness(double minTime, std::string filter) : m_minTime(minTime), m_filter(std::move(filter)) {}
+
+        /// <summary>
+        /// Check that benchmark is selected by filter
+        /// </summary>
+        /// <param name="name">full name of benchmark</param>
+        /// <returns>true if benchmark is run else false</returns>
+        bool isEnabled(const std::string& name) const {
+            return m_filter.empty() || name.find(m_filter) != std::string::npos;
+        }
+
+        /// <summary>
+        /// Measure body
+        /// </summary>
+        /// <param name="name">name of measured function</param>
+        /// <param name="input">name of input</param>
+        /// <param name="size">count of nodes of input</param>
+        /// <param name="body">measured function, it is called many times</param>
+        template <class Body>
+        void run(const std::string& name, const std::string& input, size_t size, Body body) {
+            auto fullName { name + "/" + input + "/" + std::to_string(size) };
+            if (!isEnabled(fullName)) {
+                return;
+            }
+
+            // warm up and estimate time of one iteration
+            body();
+
+            using Clock = std::chrono::steady_clock;
+            size_t iterations{ 1 }, total{};
+            double elapsed{}, best { HUGE_VAL };
+            while (true) {
+                auto start { Clock::now() };
+                for (size_t i{}; i < iterations; ++i) {
+                    body();
+                }
+                double round { std::chrono::duration<double>(Clock::now() - start).count() };
+                total += iterations;
+                elapsed += round;
+                best = std::min(best, round / iterations);
+                if (round >= m_minTime || elapsed >= 2 * m_minTime) {
+                    break;
+                }
+                iterations *= 2;
+            }
+
+            m_results.push_back(BenchmarkResult{ fullName, input, size, total, elapsed / total * 1e9, best * 1e9 });
+            if (m_log != nullptr) {
+                *m_log << fullName << ": " << m_results.back().meanTime << " ns" << std::endl;
+            }
+        }
+
+        /// <summary>
+        /// Set stream for progress of run
+        /// </summary>
+        /// <param name="log">not owned stream, nullptr disables progress</param>
+        void setLog(std::ostream* log) {
+            m_log = log;
+        }
+
+        /// <summary>
+        /// Write all results in JSON
+        /// </summary>
+        /// <param name="out">output stream</param>
+        /// <param name="context">list of "key": "value" pairs that describe build</param>
+        void writeJson(std::ostream& out, const std::vector<std::pair<std::string, std::string>>& context) const {
+            out << "{\n  \"context\": {";
+            for (size_t i{}; i < context.size(); ++i) {
+                out << (i > 0 ? "," : "") << "\n    \"" << context[i].first << "\": \"" << context[i].second << "\"";
+            }
+            out << "\n  },\n  \"benchmarks\": [";
+            for (size_t i{}; i < m_results.size(); ++i) {
+                const auto& r { m_results[i] };
+                out << (i > 0 ? "," : "") << "\n    {"
+                    << "\"name\": \"" << r.name << "\", "
+                    << "\"input\": \"" << r.input << "\", "
+                    << "\"size\": " << r.size << ", "
+                    << "\"iterations\": " << r.iterations << ", "
+                    << "\"real_time\": " << r.meanTime << ", "
+                    << "\"min_time\": " << r.minTime << ", "
+                    << "\"time_unit\": \"ns\"}";
+            }
+            out << "\n  ]\n}\n";
+        }
+    private:
+        double m_minTime;
+        std::string m_filter;
+        std::ostream* m_log{};
+        std::vector<BenchmarkResult> m_results;
+};
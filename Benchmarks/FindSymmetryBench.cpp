@@ -0,0 +1,235 @@
+#include "BenchHarness.hpp"
+#include "PolygonGenerators.hpp"
+#include "SymmetryFinder.hpp"
+#include "ApproximateSymmetry.hpp"
+#include "CurveSymmetry.hpp"
+#include "PolygonReader.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+/// <summary>
+/// Options of benchmark run
+/// </summary>
+struct BenchOptions {
+    size_t maxSize { 10000000 };
+    size_t maxQuadraticSize { 4096 };
+    size_t maxReadSize { 1000000 };
+    double minTime { 0.2 };
+    std::string filter{};
+    std::string output{};
+};
+
+static BenchOptions parseOptions(int argc, char* argv[]) {
+    BenchOptions options{};
+    for (int i{ 1 }; i < argc; ++i) {
+        std::string arg { argv[i] };
+        if (i + 1 >= argc) {
+            throw std::runtime_error("Option has no value: " + arg);
+        }
+        std::string value { argv[++i] };
+        if (arg == "--max-size") {
+            options.maxSize = std::stoull(value);
+        } else if (arg == "--max-quadratic-size") {
+            options.maxQuadraticSize = std::stoull(value);
+        } else if (arg == "--max-read-size") {
+            options.maxReadSize = std::stoull(value);
+        } else if (arg == "--min-time") {
+            options.minTime = std::stod(value);
+        } else if (arg == "--filter") {
+            options.filter = value;
+        } else if (arg == "--out") {
+            options.output = value;
+        } else {
+            throw std::runtime_error("Unknown option: " + arg);
+        }
+    }
+    return options;
+}
+
+/// <summary>
+/// Sizes of inputs: powers of 4 from 4 and max size
+/// </summary>
+static std::vector<size_t> getSizes(size_t maxSize) {
+    std::vector<size_t> sizes{};
+    for (size_t size{ 4 }; size < maxSize; size *= 4) {
+        sizes.push_back(size);
+    }
+    sizes.push_back(maxSize);
+    return sizes;
+}
+
+static const char* getKernelName() {
+#if defined(__AVX2__)
+    return "AVX2";
+#elif defined(FINDSYMMETRY_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+static void runFindSymmetry(BenchHarness& harness, const BenchOptions& options, const BenchInput& input, size_t size) {
+    std::pair<const char*, SymmetryEngine> engines[] {
+        { "Linear", SymmetryEngine::Linear },
+        { "Vectorized", SymmetryEngine::Vectorized },
+        { "MixedPrecision", SymmetryEngine::MixedPrecision },
+        { "Reference", SymmetryEngine::Reference },
+    };
+    for (const auto& [name, engine] : engines) {
+        // candidate engines take O(N^2)
+        if (engine != SymmetryEngine::Linear && size > options.maxQuadraticSize) {
+            continue;
+        }
+        SymmetryFinder<double> finder { engine };
+        harness.run(std::string("findSymmetry/") + name, input.name, size, [&] {
+            auto axes { finder.findSymmetry(input.polygon, input.epsilon) };
+            doNotOptimize(axes.data());
+        });
+    }
+    // exact integer path on polygon snapped to lattice with step 1e-6
+    if (input.name != "big" && input.name != "small") {
+        std::vector<Point2<int64_t>> nodes{};
+        nodes.reserve(size);
+        for (const auto& node : input.polygon.getNodes()) {
+            nodes.push_back(Point2<int64_t>(std::llround(node.x * 1e6), std::llround(node.y * 1e6)));
+        }
+        Polygon<int64_t> lattice { std::move(nodes) };
+        SymmetryFinder<int64_t> finder{};
+        harness.run("findSymmetry/Exact", input.name, size, [&] {
+            auto axes { finder.findSymmetry(lattice, 0) };
+            doNotOptimize(axes.data());
+        });
+    }
+    // coarse-to-fine approximate axes, O(N log N)
+    ApproximateSymmetry<double> approximate{};
+    harness.run("findSymmetry/Approximate", input.name, size, [&] {
+        auto axes { approximate.findAxes(input.polygon, 1) };
+        doNotOptimize(axes.data());
+    });
+    // FFT over 1024 arc length samples and refinement of found axes by nodes
+    CurveSymmetry<double> curve{};
+    harness.run("findSymmetry/Curve", input.name, size, [&] {
+        auto axes { curve.findSymmetry(input.polygon, 1e-4) };
+        doNotOptimize(axes.data());
+    });
+}
+
+/// <summary>
+/// Curve mode on dense regular polygons: every shift of signal is a peak, so this case shows
+/// cost of refinement of K best peaks against N nodes next to the cost of FFT alone
+/// </summary>
+static void runCurveLarge(BenchHarness& harness, size_t maxSize) {
+    for (size_t size{ 16384 }; size <= maxSize && size <= 1048576; size *= 4) {
+        auto polygon { regularPolygon(size, 3.0) };
+        CurveSymmetry<double> refined{}, sampled{};
+        sampled.setRefine(false);
+        harness.run("curveLarge/Refined", "regular", size, [&] {
+            auto axes { refined.findSymmetry(polygon, 1e-4) };
+            doNotOptimize(axes.data());
+        });
+        harness.run("curveLarge/Sampled", "regular", size, [&] {
+            auto axes { sampled.findSymmetry(polygon, 1e-4) };
+            doNotOptimize(axes.data());
+        });
+    }
+}
+
+static void runPolygon(BenchHarness& harness, const BenchInput& input, size_t size) {
+    SymmetryFinder<double> finder{};
+    harness.run("findCandidates", input.name, size, [&] {
+        auto candidates { finder.findCandidates(input.polygon) };
+        doNotOptimize(candidates.data());
+    });
+
+    // shifted copy, so start node is found in the middle of polygon
+    const auto& nodes { input.polygon.getNodes() };
+    std::vector<Point2<double>> shifted(nodes.begin() + size / 2, nodes.end());
+    shifted.insert(shifted.end(), nodes.begin(), nodes.begin() + size / 2);
+    Polygon<double> other { std::move(shifted) };
+    harness.run("isEqual", input.name, size, [&] {
+        bool equal { input.polygon.isEqual(other, input.epsilon) };
+        doNotOptimize(equal);
+    });
+
+    Polygon<double> rotated { input.polygon };
+    Point2<double> direction { Point2<double>(1, 2).getNormalized() };
+    harness.run("rotate", input.name, size, [&] {
+        rotated.rotate(std::acos(-1), direction);
+        doNotOptimize(rotated.getNodes().data());
+    });
+}
+
+static void runRead(BenchHarness& harness, const BenchInput& input, size_t size) {
+    auto name { "readPolygon/" + input.name + "/" + std::to_string(size) };
+    if (!harness.isEnabled(name)) {
+        return;
+    }
+
+    auto path { std::filesystem::temp_directory_path() / "find_symmetry_bench.txt" };
+    {
+        std::ofstream out(path);
+        out.precision(17);
+        for (const auto& node : input.polygon.getNodes()) {
+            out << node.x << " " << node.y << "\n";
+        }
+    }
+    harness.run("readPolygon", input.name, size, [&] {
+        auto polygon { readPolygon<double>(path.string()) };
+        doNotOptimize(polygon.getNodes().data());
+    });
+    std::filesystem::remove(path);
+}
+
+/// <summary>
+/// Entry point of benchmarks. Options:
+/// --max-size N, --max-quadratic-size N (limit for Vectorized and Reference engines),
+/// --max-read-size N, --min-time seconds, --filter substring, --out file.json
+/// </summary>
+int main(int argc, char* argv[]) {
+    try {
+        auto options { parseOptions(argc, argv) };
+        BenchHarness harness { options.minTime, options.filter };
+        harness.setLog(&std::cerr);
+
+        for (auto size : getSizes(options.maxSize)) {
+            for (const auto& inputName : getInputNames()) {
+                auto input { makeInput(inputName, size) };
+                runFindSymmetry(harness, options, input, size);
+                runPolygon(harness, input, size);
+                if (size <= options.maxReadSize) {
+                    runRead(harness, input, size);
+                }
+            }
+        }
+        runCurveLarge(harness, options.maxSize);
+
+        std::vector<std::pair<std::string, std::string>> context {
+            { "kernel", getKernelName() },
+            { "threads", std::to_string(std::thread::hardware_concurrency()) },
+#ifdef NDEBUG
+            { "build", "release" },
+#else
+            { "build", "debug" },
+#endif
+        };
+        if (options.output.empty()) {
+            harness.writeJson(std::cout, context);
+        } else {
+            std::ofstream out(options.output);
+            harness.writeJson(out, context);
+        }
+
+        return 0;
+    }
+    catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return -1;
+    }
+}
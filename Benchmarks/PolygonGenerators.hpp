@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Generated input of benchmark
+/// </summary>
+struct BenchInput {
+    std::string name;
+    Polygon<double> polygon;
+    double epsilon;
+};
+
+/// <summary>
+/// Regular polygon with center in (0, 0), it has size axes of symmetry
+/// </summary>
+inline Polygon<double> regularPolygon(size_t size, double radius) {
+    std::vector<Point2<double>> nodes(size);
+    for (size_t i{}; i < size; ++i) {
+        double angle { 2 * std::acos(-1) * i / size };
+        nodes[i] = Point2<double>(radius * std::cos(angle), radius * std::sin(angle));
+    }
+    return Polygon<double>{ std::move(nodes) };
+}
+
+/// <summary>
+/// Star-shaped polygon with random radii, it has no axes of symmetry
+/// </summary>
+inline Polygon<double> randomPolygon(size_t size, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> radius(1.0, 2.0);
+    std::vector<Point2<double>> nodes(size);
+    for (size_t i{}; i < size; ++i) {
+        double angle { 2 * std::acos(-1) * i / size }, r { radius(gen) };
+        nodes[i] = Point2<double>(r * std::cos(angle), r * std::sin(angle));
+    }
+    return Polygon<double>{ std::move(nodes) };
+}
+
+/// <summary>
+/// Star-shaped polygon that is symmetric relative to x axis except one node,
+/// so axis is rejected only after most of nodes are compared
+/// </summary>
+inline Polygon<double> nearSymmetricPolygon(size_t size, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> radius(1.0, 2.0);
+    size_t half { size > 2 ? (size - 2) / 2 : 0 };
+    std::vector<Point2<double>> upper(half);
+    for (size_t i{}; i < half; ++i) {
+        double angle { std::acos(-1) * (i + 1) / (half + 1) }, r { radius(gen) };
+        upper[i] = Point2<double>(r * std::cos(angle), r * std::sin(angle));
+    }
+
+    std::vector<Point2<double>> nodes{ Point2<double>(radius(gen), 0) };
+    nodes.reserve(size);
+    nodes.insert(nodes.end(), upper.begin(), upper.end());
+    nodes.push_back(Point2<double>(-radius(gen), 0));
+    for (auto it { upper.rbegin() }; it != upper.rend(); ++it) {
+        nodes.push_back(Point2<double>(it->x, -it->y));
+    }
+    if (nodes.size() < size) {
+        nodes.push_back(Point2<double>(radius(gen), -1e-3));
+    }
+    nodes[nodes.size() - 1 - half / 2].y *= 1 + 1e-4;
+    return Polygon<double>{ std::move(nodes) };
+}
+
+/// <summary>
+/// Polygon with all nodes multiplied by factor
+/// </summary>
+inline Polygon<double> scaledPolygon(const Polygon<double>& p, double factor) {
+    std::vector<Point2<double>> nodes { p.getNodes() };
+    for (auto& node : nodes) {
+        node = factor * node;
+    }
+    return Polygon<double>{ std::move(nodes) };
+}
+
+/// <summary>
+/// Names of generated inputs
+/// </summary>
+inline std::vector<std::string> getInputNames() {
+    return { "regular", "random", "nearSymmetric", "big", "small" };
+}
+
+/// <summary>
+/// Generate input by name. Precision of big and small inputs is the same as in
+/// UnitTestBigNum.cpp and UnitTestSmallNum.cpp
+/// </summary>
+inline BenchInput makeInput(const std::string& name, size_t size) {
+    if (name == "regular") {
+        return BenchInput{ name, regularPolygon(size, 3.0), 1e-8 };
+    }
+    if (name == "random") {
+        return BenchInput{ name, randomPolygon(size, 1), 1e-8 };
+    }
+    if (name == "nearSymmetric") {
+        return BenchInput{ name, nearSymmetricPolygon(size, 1), 1e-8 };
+    }
+    if (name == "big") {
+        return BenchInput{ name, scaledPolygon(regularPolygon(size, 3.0), 1e12), 1e-2 };
+    }
+    return BenchInput{ name, scaledPolygon(regularPolygon(size, 3.0), 1e-12), 1e-20 };
+}
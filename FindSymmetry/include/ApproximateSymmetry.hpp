@@ -0,0 +1,382 @@
+#pragma once
+
+#include "Point2.hpp"
+#include "Polygon.hpp"
+#include "PolygonView.hpp"
+#include "Axis.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+/// <summary>
+/// Axis of approximate symmetry with reflection error of polygon
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+struct ApproximateAxis {
+    /// <summary>
+    /// Axis through center of polygon, its ends are on boundary
+    /// </summary>
+    Axis<T> axis;
+    /// <summary>
+    /// Root mean square of distances between reflected boundary points and their pairs
+    /// </summary>
+    double rmsError;
+    /// <summary>
+    /// Max distance between reflected boundary point and its pair, upper bound of Hausdorff
+    /// distance between sampled boundary and its reflection
+    /// </summary>
+    double maxError;
+};
+
+/// <summary>
+/// Best axes of approximate symmetry of noisy contours with their reflection errors.
+/// Boundary is sampled uniformly by arc length. Reflection keeps arc length, so axis through
+/// boundary points at arc lengths a and a + L / 2 maps sample at s to sample at 2a - s: axis is
+/// a cyclic shift k of pairing j -> k - j. For every shift the best line and its RMS error are
+/// found in closed form from 2x2 sums in O(M) for M samples.
+/// Search is coarse-to-fine: all shifts are scored on coarse sampling in O(M^2), best local
+/// minima are refined on samplings 4 times finer in small windows up to one sample per node,
+/// so contour with N nodes costs O(N log N) instead of O(N^2) of exact check.
+/// </summary>
+/// <typeparam name="T">floating point type</typeparam>
+template <class T>
+class ApproximateSymmetry {
+    static_assert(std::is_floating_point_v<T>, "Approximate symmetry needs floating point coords");
+    public:
+        /// <summary>
+        /// base constructor
+        /// </summary>
+        ApproximateSymmetry() {}
+
+        /// <summary>
+        /// Get count of samples of coarse level
+        /// </summary>
+        /// <returns>count of samples</returns>
+        size_t getCoarseSize() const {
+            return m_coarseSize;
+        }
+
+        /// <summary>
+        /// Set count of samples of coarse level, all shifts of coarse level are scored
+        /// </summary>
+        /// <param name="size">count of samples, not less than 8</param>
+        void setCoarseSize(size_t size) {
+            m_coarseSize = std::max<size_t>(size, 8);
+        }
+
+        /// <summary>
+        /// Get count of candidates that are refined on fine levels
+        /// </summary>
+        /// <returns>count of candidates</returns>
+        size_t getRefineCount() const {
+            return m_refineCount;
+        }
+
+        /// <summary>
+        /// Set count of candidates that are refined on fine levels
+        /// </summary>
+        /// <param name="count">count of candidates, not less than 1</param>
+        void setRefineCount(size_t count) {
+            m_refineCount = std::max<size_t>(count, 1);
+        }
+
+        /// <summary>
+        /// Find best axes of approximate symmetry
+        /// </summary>
+        /// <param name="p">polygon</param>
+        /// <param name="count">max count of axes</param>
+        /// <returns>axes in order of increasing RMS error</returns>
+        std::vector<ApproximateAxis<T>> findAxes(const Polygon<T>& p, size_t count) const {
+            return findAxes(PolygonView<T>(p), count);
+        }
+
+        /// <summary>
+        /// Find best axes of approximate symmetry of polygon that is not owned
+        /// </summary>
+        /// <param name="p">view of polygon</param>
+        /// <param name="count">max count of axes</param>
+        /// <returns>axes in order of increasing RMS error</returns>
+        std::vector<ApproximateAxis<T>> findAxes(const PolygonView<T>& p, size_t count) const {
+            std::vector<ApproximateAxis<T>> result{};
+            auto size { p.size() };
+            if (size < 3 || count == 0) {
+                return result;
+            }
+
+            // arc length from node 0 to every node. Length is measured by chords over every stride-th
+            // node, so noise of dense contour does not make boundary longer and shift pairs of samples
+            size_t stride { std::max<size_t>(1, size / m_coarseSize) };
+            std::vector<double> lengths(size + 1);
+            for (size_t begin{}; begin < size; begin += stride) {
+                size_t end { std::min(begin + stride, size) };
+                auto a { p[begin] }, b { p[end < size ? end : 0] };
+                double chord { std::hypot(double(b.x) - a.x, double(b.y) - a.y) };
+                for (size_t i{ begin }; i < end; ++i) {
+                    lengths[i + 1] = lengths[begin] + chord * (i + 1 - begin) / (end - begin);
+                }
+            }
+            if (!(lengths[size] > 0)) {
+                return result;
+            }
+
+            // coarse level: all shifts, best local minima are kept
+            Level level{};
+            resample(p, lengths, m_coarseSize, level);
+            std::vector<Candidate> candidates{};
+            std::vector<double> scores(level.size);
+            for (size_t k{}; k < level.size; ++k) {
+                scores[k] = score(level, k).rms;
+            }
+            for (size_t k{}; k < level.size; ++k) {
+                double previous { scores[k > 0 ? k - 1 : level.size - 1] }, next { scores[k + 1 < level.size ? k + 1 : 0] };
+                if (scores[k] <= previous && scores[k] < next) {
+                    candidates.push_back(Candidate{ k, scores[k] });
+                }
+            }
+            select(candidates, std::max(m_refineCount, count));
+
+            // fine levels: every candidate is moved to best shift in its window
+            std::vector<size_t> sizes{};
+            for (size_t fine { level.size * 4 }; fine < size; fine *= 4) {
+                sizes.push_back(fine);
+            }
+            if (size > level.size) {
+                sizes.push_back(size);
+            }
+            for (auto fine : sizes) {
+                double ratio { double(fine) / level.size };
+                auto radius { static_cast<size_t>(std::ceil(ratio)) + 1 };
+                resample(p, lengths, fine, level);
+                for (auto& candidate : candidates) {
+                    auto center { static_cast<size_t>(std::llround(candidate.shift * ratio)) % fine };
+                    candidate.rms = HUGE_VAL;
+                    for (size_t d{}; d <= 2 * radius; ++d) {
+                        auto k { (center + fine - radius + d) % fine };
+                        auto rms { score(level, k).rms };
+                        if (rms < candidate.rms) {
+                            candidate = Candidate{ k, rms };
+                        }
+                    }
+                }
+                select(candidates, std::max(m_refineCount, count));
+            }
+
+            // for sparse polygons pairs of best axes are centered on continuous arc length between shifts
+            // of finest level, dense contours have step of samples below noise. Then errors and ends are found
+            for (size_t i{}; i < std::min(count, candidates.size()); ++i) {
+                result.push_back(level.size <= 16 * m_coarseSize ? refine(p, lengths, candidates[i].shift, level)
+                                                                 : getAxis(level, candidates[i].shift));
+            }
+            std::sort(result.begin(), result.end(), [](const ApproximateAxis<T>& a, const ApproximateAxis<T>& b) {
+                return a.rmsError < b.rmsError;
+            });
+            return result;
+        }
+    private:
+        /// <summary>
+        /// Uniform samples of boundary and their sums that do not depend on shift
+        /// </summary>
+        struct Level {
+            size_t size;
+            std::vector<Point2<double>> samples;
+            Point2<double> center;
+            double uxx, uxy, uyy;
+        };
+
+        struct Candidate {
+            size_t shift;
+            double rms;
+        };
+
+        /// <summary>
+        /// Best line for pairing of shift
+        /// </summary>
+        struct Fit {
+            Point2<double> direction;
+            double rms;
+        };
+
+        /// <summary>
+        /// Sample boundary uniformly by arc length, samples are relative to their center
+        /// </summary>
+        /// <param name="p">polygon</param>
+        /// <param name="lengths">arc length from node 0 to every node</param>
+        /// <param name="count">count of samples</param>
+        /// <param name="level">output: samples</param>
+        /// <param name="offset">arc length of first sample, in [0, L)</param>
+        static void resample(const PolygonView<T>& p, const std::vector<double>& lengths, size_t count, Level& level, double offset = 0) {
+            auto size { p.size() };
+            double length { lengths[size] }, step { length / count };
+            level.size = count;
+            level.samples.resize(count);
+            level.center = Point2<double>{};
+            size_t i { static_cast<size_t>(std::upper_bound(lengths.begin(), lengths.begin() + size, offset) - lengths.begin()) - 1 };
+            bool wrapped{};
+            for (size_t j{}; j < count; ++j) {
+                double s { offset + j * step };
+                if (s >= length) {
+                    // samples go through node 0 again
+                    s -= length;
+                    if (!wrapped) {
+                        wrapped = true;
+                        i = 0;
+                    }
+                }
+                while (i + 1 < size && lengths[i + 1] <= s) {
+                    ++i;
+                }
+                auto a { p[i] }, b { p[i + 1 < size ? i + 1 : 0] };
+                double edge { lengths[i + 1] - lengths[i] };
+                double t { edge > 0 ? (s - lengths[i]) / edge : 0 };
+                level.samples[j] = Point2<double>(a.x + t * (double(b.x) - a.x), a.y + t * (double(b.y) - a.y));
+                level.center += level.samples[j];
+            }
+            level.center /= double(count);
+
+            level.uxx = level.uxy = level.uyy = 0;
+            for (auto& sample : level.samples) {
+                sample -= level.center;
+                level.uxx += sample.x * sample.x;
+                level.uxy += sample.x * sample.y;
+                level.uyy += sample.y * sample.y;
+            }
+        }
+
+        /// <summary>
+        /// Find best line for pairing j -> k - j. Line goes through center of samples, error of
+        /// sample u with pair v and line normal n is d - 2 (u, n) n for d = u - v, so sum of squared
+        /// errors is sum |d|^2 + 4 n^T (U - X) n with U = sum u u^T, X = sym(sum u d^T).
+        /// It is minimal when n is eigenvector of smallest eigenvalue of U - X
+        /// </summary>
+        /// <param name="level">samples</param>
+        /// <param name="k">shift of pairing</param>
+        /// <returns>direction of line and RMS error</returns>
+        static Fit score(const Level& level, size_t k) {
+            auto size { level.size };
+            const auto* samples { level.samples.data() };
+            double dd{}, xxx{}, xxy{}, xyy{};
+            for (size_t j{}; j < size; ++j) {
+                const auto& u { samples[j] };
+                const auto& v { samples[k >= j ? k - j : k + size - j] };
+                double dx { u.x - v.x }, dy { u.y - v.y };
+                dd += dx * dx + dy * dy;
+                xxx += u.x * dx;
+                xxy += u.x * dy + u.y * dx;
+                xyy += u.y * dy;
+            }
+
+            double a { level.uxx - xxx }, b { level.uxy - xxy / 2 }, c { level.uyy - xyy };
+            double smallest { (a + c) / 2 - std::hypot((a - c) / 2, b) };
+            // axis is eigenvector of largest eigenvalue, it is orthogonal to normal
+            double angle { std::atan2(2 * b, a - c) / 2 };
+            return Fit{ Point2<double>(std::cos(angle), std::sin(angle)), std::sqrt(std::max(0.0, (dd + 4 * smallest) / size)) };
+        }
+
+        /// <summary>
+        /// Find arc length a of axis end between neighbour shifts by golden section search.
+        /// Samples start at a, so pairing of axis is shift 0
+        /// </summary>
+        /// <param name="p">polygon</param>
+        /// <param name="lengths">arc length from node 0 to every node</param>
+        /// <param name="shift">best shift on level</param>
+        /// <param name="level">samples of finest level, output: samples that start at a</param>
+        /// <returns>axis with errors</returns>
+        static ApproximateAxis<T> refine(const PolygonView<T>& p, const std::vector<double>& lengths, size_t shift, Level& level) {
+            double length { lengths[p.size()] }, step { length / level.size };
+            auto count { level.size };
+            auto error = [&](double a) {
+                a = std::fmod(a, length);
+                resample(p, lengths, count, level, a < 0 ? a + length : a);
+                return score(level, 0).rms;
+            };
+
+            double ratio { (std::sqrt(5.0) - 1) / 2 };
+            // shift 0 is axis through node 0, its window starts before node 0
+            double left { (double(shift) - 1) * step / 2 }, right { (double(shift) + 1) * step / 2 };
+            double x1 { right - ratio * (right - left) }, x2 { left + ratio * (right - left) };
+            double f1 { error(x1) }, f2 { error(x2) };
+            for (int i{}; i < 24; ++i) {
+                if (f1 < f2) {
+                    right = x2;
+                    x2 = x1;
+                    f2 = f1;
+                    x1 = right - ratio * (right - left);
+                    f1 = error(x1);
+                } else {
+                    left = x1;
+                    x1 = x2;
+                    f1 = f2;
+                    x2 = left + ratio * (right - left);
+                    f2 = error(x2);
+                }
+            }
+
+            // shift of grid is kept if search does not improve it
+            auto best { f1 < f2 ? x1 : x2 };
+            if (std::min(f1, f2) > error(shift * step / 2)) {
+                best = shift * step / 2;
+            }
+            error(best);
+            return getAxis(level, 0);
+        }
+
+        /// <summary>
+        /// Build axis of shift with its errors
+        /// </summary>
+        /// <param name="level">samples</param>
+        /// <param name="k">shift of pairing</param>
+        /// <returns>axis with errors</returns>
+        static ApproximateAxis<T> getAxis(const Level& level, size_t k) {
+            auto fit { score(level, k) };
+            auto size { level.size };
+            Point2<double> normal { -fit.direction.y, fit.direction.x };
+            // closed form of score loses presision near zero, so errors are summed directly
+            double sum{}, maxError{};
+            for (size_t j{}; j < size; ++j) {
+                const auto& u { level.samples[j] };
+                const auto& v { level.samples[k >= j ? k - j : k + size - j] };
+                double twoDot { 2 * (u.x * normal.x + u.y * normal.y) };
+                double error { std::hypot(u.x - twoDot * normal.x - v.x, u.y - twoDot * normal.y - v.y) };
+                sum += error * error;
+                maxError = std::max(maxError, error);
+            }
+
+            // ends are boundary points at arc lengths a and a + L / 2 projected on line
+            auto end = [&](double position) {
+                auto i { static_cast<size_t>(position) % size };
+                double t { position - std::floor(position) };
+                const auto& a { level.samples[i] };
+                const auto& b { level.samples[i + 1 < size ? i + 1 : 0] };
+                double projection { (a.x + t * (b.x - a.x)) * fit.direction.x + (a.y + t * (b.y - a.y)) * fit.direction.y };
+                return Point2<T>(T(level.center.x + projection * fit.direction.x), T(level.center.y + projection * fit.direction.y));
+            };
+            return ApproximateAxis<T>{ Axis<T>(end(k / 2.0), end(k / 2.0 + size / 2.0)), std::sqrt(sum / size), maxError };
+        }
+
+        /// <summary>
+        /// Keep best candidates with different shifts
+        /// </summary>
+        /// <param name="candidates">candidates, output: best candidates in order of increasing error</param>
+        /// <param name="count">max count of kept candidates</param>
+        static void select(std::vector<Candidate>& candidates, size_t count) {
+            std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+                return a.rms < b.rms || (a.rms == b.rms && a.shift < b.shift);
+            });
+            std::vector<Candidate> kept{};
+            for (const auto& candidate : candidates) {
+                if (kept.size() == count) {
+                    break;
+                }
+                if (std::none_of(kept.begin(), kept.end(), [&](const Candidate& c) { return c.shift == candidate.shift; })) {
+                    kept.push_back(candidate);
+                }
+            }
+            candidates = std::move(kept);
+        }
+
+        size_t m_coarseSize{ 256 };
+        size_t m_refineCount{ 8 };
+};
@@ -31,6 +31,22 @@ class Axis {
             m_start.isEqual(axis.m_end, epsilon) && m_end.isEqual(axis.m_start, epsilon);
         }
 
+        /// <summary>
+        /// Get first point
+        /// </summary>
+        /// <returns>first point of axis</returns>
+        const Point2<T>& getStart() const {
+            return m_start;
+        }
+
+        /// <summary>
+        /// Get second point
+        /// </summary>
+        /// <returns>second point of axis</returns>
+        const Point2<T>& getEnd() const {
+            return m_end;
+        }
+
         /// <summary>
         /// It represents axis as string format 
         /// </summary>
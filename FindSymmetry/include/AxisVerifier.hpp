@@ -0,0 +1,229 @@
+#pragma once
+
+#include "Point2.hpp"
+#include "PolygonSoA.hpp"
+#include "CompactAxis.hpp"
+#include "EdgeAngleSequence.hpp"
+#include "ReflectKernel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <numeric>
+#include <vector>
+
+/// <summary>
+/// Check of axes and rotations that are found by matching of edge/angle sequence.
+/// Tokens are compared one by one with relative presision, so small errors of tokens
+/// add up along polygon and mirrored nodes can be far more than epsilon apart.
+/// Order of nodes of matched shift is known, so nodes with center in (0, 0) are reflected
+/// and compared with their mirrors like in Vectorized engine, O(N) per axis.
+/// Polygon with many axes (regular polygon has N) is first checked as whole group in O(N):
+/// nodes are averaged over their orbits, which gives ideal polygon that is exactly symmetric
+/// under all matched axes, so by triangle inequality every reflected node is within twice
+/// the max distance of nodes from ideal polygon from its mirror. Only if this bound is greater
+/// than epsilon axes are checked one by one, so O(N K) for K axes is left only for polygons
+/// whose nodes are off by about epsilon.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class AxisVerifier {
+    public:
+        /// <summary>
+        /// Prepare nodes of polygon, memory of previous build is reused
+        /// </summary>
+        /// <param name="nodes">nodes of polygon</param>
+        template <class Nodes>
+        void build(const Nodes& nodes) {
+            m_nodes.assign(nodes);
+            auto size { m_nodes.size() };
+            Point2<T> center{};
+            for (size_t i{}; i < size; ++i) {
+                center += m_nodes[i];
+            }
+            if (size > 0) {
+                center /= static_cast<T>(size);
+            }
+            m_nodes.translate(center);
+            m_targets.build(m_nodes);
+
+            // the farthest node gives the most exact angle of rotation
+            m_farthest = 0;
+            for (size_t i{}; i < size; ++i) {
+                if (m_nodes[i].dot(m_nodes[i]) > m_nodes[m_farthest].dot(m_nodes[m_farthest])) {
+                    m_farthest = i;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Remove axes whose reflection does not map nodes to their mirrors with presision epsilon
+        /// </summary>
+        /// <param name="axes">axes through elements first and first + N, output: confirmed axes</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>count of compared nodes</returns>
+        size_t verifyAxes(std::vector<CompactAxis>& axes, double epsilon) {
+            auto size { m_nodes.size() };
+            if (axes.size() > 1) {
+                // rotations between axes are multiples of period
+                size_t period { size };
+                for (const auto& axis : axes) {
+                    period = std::gcd(period, (axis.first + size - axes[0].first % size) % size);
+                }
+                if (2 * getIdealError(period, axes[0].first) <= epsilon) {
+                    return 2 * size;
+                }
+            }
+            auto count { axes.size() };
+            std::erase_if(axes, [&](const CompactAxis& axis) { return !isAxis(axis.first, epsilon); });
+            return (count > 1 ? 2 * size : 0) + count * size;
+        }
+
+        /// <summary>
+        /// Remove rotations that do not map nodes to their targets with presision epsilon
+        /// </summary>
+        /// <param name="shifts">matched shifts of sequence with itself, output: confirmed shifts</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>count of compared nodes</returns>
+        size_t verifyRotations(std::vector<size_t>& shifts, double epsilon) {
+            auto size { m_nodes.size() };
+            if (shifts.size() > 1) {
+                size_t period { size };
+                for (auto shift : shifts) {
+                    period = std::gcd(period, shift / 2 % size);
+                }
+                if (2 * getIdealError(period, SIZE_MAX) <= epsilon) {
+                    return 2 * size;
+                }
+            }
+            auto count { shifts.size() };
+            std::erase_if(shifts, [&](size_t shift) { return !isRotation(shift, epsilon); });
+            return (count > 1 ? 2 * size : 0) + count * size;
+        }
+
+        /// <summary>
+        /// Check axis through elements position and position + N of edge/angle sequence,
+        /// reflection maps node i to node (position - i) mod N
+        /// </summary>
+        /// <param name="position">position of element on axis</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>true if reflected nodes are equal to their mirrors else false</returns>
+        bool isAxis(size_t position, double epsilon) const {
+            Point2<T> direction{};
+            if (!getDirection(position, direction)) {
+                return false;
+            }
+            return m_targets.isMirror(direction, position % m_nodes.size(), epsilon);
+        }
+
+        /// <summary>
+        /// Check rotation around center that maps node i to node (i + shift / 2) mod N
+        /// </summary>
+        /// <param name="shift">matched shift of sequence with itself</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>true if rotated nodes are equal to their targets else false</returns>
+        bool isRotation(size_t shift, double epsilon) const {
+            auto size { m_nodes.size() };
+            auto offset { shift / 2 % size };
+            auto from { m_nodes[m_farthest] }, to { m_nodes[(m_farthest + offset) % size] };
+            T angle { std::atan2(from.cross(to), from.dot(to)) };
+            T c { std::cos(angle) }, s { std::sin(angle) };
+
+            for (size_t i{}; i < size; ++i) {
+                auto node { m_nodes[i] };
+                Point2<T> rotated { node.x * c - node.y * s, node.x * s + node.y * c };
+                if (!rotated.isEqual(m_nodes[(i + offset) % size], epsilon)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Get size of buffers
+        /// </summary>
+        /// <returns>count of bytes</returns>
+        size_t getMemorySize() const {
+            return m_nodes.getMemorySize() + m_targets.getMemorySize() +
+                   (m_average.capacity() + m_ideal.capacity()) * sizeof(Point2<T>);
+        }
+    private:
+        /// <summary>
+        /// Get direction of axis by element on it that is farther from center
+        /// </summary>
+        bool getDirection(size_t position, Point2<T>& direction) const {
+            auto size { m_nodes.size() };
+            auto a { EdgeAngleSequence<T>::getElementPoint(m_nodes, position % (2 * size)) };
+            auto b { EdgeAngleSequence<T>::getElementPoint(m_nodes, (position + size) % (2 * size)) };
+            auto point { a.dot(a) >= b.dot(b) ? a : b };
+            if (point.dot(point) == 0) {
+                return false;
+            }
+            direction = point.getNormalized();
+            return true;
+        }
+
+        /// <summary>
+        /// Build ideal polygon that is exactly symmetric under rotation by period and, if position
+        /// is given, under reflection of axis through element position, and get max distance of
+        /// nodes from it. Node b of first period is average of nodes b + l * period rotated back
+        /// by l turns and then of its reflected mirror. Turn is exact fraction of full turn, so
+        /// ideal polygon is closed. Takes O(N)
+        /// </summary>
+        /// <param name="period">count of nodes between rotated copies</param>
+        /// <param name="position">position of element on axis, SIZE_MAX if there is no axis</param>
+        /// <returns>max distance, infinity if axis has no direction</returns>
+        T getIdealError(size_t period, size_t position) {
+            auto size { m_nodes.size() };
+            auto copies { size / period };
+            auto from { m_nodes[m_farthest] }, to { m_nodes[(m_farthest + period) % size] };
+            double turn { std::atan2(double(from.cross(to)), double(from.dot(to))) };
+            double step { 2 * std::numbers::pi * std::round(turn * copies / (2 * std::numbers::pi)) / copies };
+            auto rotate = [step](const Point2<T>& p, size_t l, double sign) {
+                T c { T(std::cos(step * l)) }, s { T(sign * std::sin(step * l)) };
+                return Point2<T>(p.x * c - p.y * s, p.x * s + p.y * c);
+            };
+
+            m_average.assign(period, Point2<T>{});
+            for (size_t l{}; l < copies; ++l) {
+                for (size_t b{}; b < period; ++b) {
+                    m_average[b] += rotate(m_nodes[b + l * period], l, -1);
+                }
+            }
+            for (auto& node : m_average) {
+                node /= static_cast<double>(copies);
+            }
+
+            m_ideal.assign(m_average.begin(), m_average.end());
+            if (position != SIZE_MAX) {
+                Point2<T> direction{};
+                if (!getDirection(position, direction)) {
+                    return std::numeric_limits<T>::infinity();
+                }
+                // mirror of node b is node position - b = b' + l' * period
+                for (size_t b{}; b < period; ++b) {
+                    auto mirror { (position % size + size - b) % size };
+                    auto node { rotate(m_average[mirror % period], mirror / period, 1) };
+                    T twoDot { 2 * node.dot(direction) };
+                    m_ideal[b] = (m_average[b] + twoDot * direction - node) / T(2);
+                }
+            }
+
+            T error{};
+            for (size_t l{}; l < copies; ++l) {
+                for (size_t b{}; b < period; ++b) {
+                    auto node { rotate(m_ideal[b], l, 1) - m_nodes[b + l * period] };
+                    error = std::max(error, std::hypot(node.x, node.y));
+                }
+            }
+            return error;
+        }
+
+        PolygonSoA<T> m_nodes;
+        ReflectionTargets<T> m_targets;
+        std::vector<Point2<T>> m_average;
+        std::vector<Point2<T>> m_ideal;
+        size_t m_farthest{};
+};
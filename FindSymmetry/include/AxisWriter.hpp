@@ -0,0 +1,243 @@
+#pragma once
+
+#include "Point2.hpp"
+#include "Axis.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// <summary>
+/// Format of written axes
+/// </summary>
+enum class AxisFormat {
+    /// <summary>
+    /// "label:" line, then "(x, y) - (x, y)" line for every axis or "non-symmetric",
+    /// coords have 6 digits after point like Axis::toString
+    /// </summary>
+    Text,
+    /// <summary>
+    /// One JSON object per polygon: {"label":"...","axes":[[x1,y1,x2,y2],...]},
+    /// coords are shortest strings that are read back exactly, nan and inf are null
+    /// </summary>
+    Json,
+    /// <summary>
+    /// Stream header (AxisStreamHeader), then record per polygon: uint32 length of label,
+    /// uint32 count of axes, label, count * 4 float64 (start x, start y, end x, end y)
+    /// </summary>
+    Binary
+};
+
+/// <summary>
+/// Header of binary axis stream, values are stored in byte order of writer like in PolygonFile
+/// </summary>
+struct AxisStreamHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+
+    static constexpr char kMagic[8] { 'P', 'S', 'Y', 'M', 'A', 'X', 'S', '\0' };
+    static constexpr uint32_t kVersion { 1 };
+    static constexpr uint32_t kByteOrder { 0x01020304 };
+};
+
+static_assert(sizeof(AxisStreamHeader) == 16, "header of axis stream must be 16 bytes");
+
+/// <summary>
+/// Buffered writer of axes of many polygons. Numbers are formatted by std::to_chars into one
+/// reused buffer without temporary strings, buffer is written into stream when it is full and
+/// stream is flushed once by flush, so output of millions of polygons is not flushed per line.
+/// </summary>
+class AxisWriter {
+    public:
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="out">output stream, it must live longer than writer</param>
+        /// <param name="format">format of output</param>
+        /// <param name="bufferSize">size of buffer that is written at once</param>
+        explicit AxisWriter(std::ostream& out, AxisFormat format = AxisFormat::Text, size_t bufferSize = 1 << 16)
+            : m_out(out), m_format(format), m_bufferSize(bufferSize) {
+            m_buffer.reserve(bufferSize + 256);
+        }
+
+        AxisWriter(const AxisWriter&) = delete;
+        AxisWriter& operator=(const AxisWriter&) = delete;
+
+        /// <summary>
+        /// Destructor writes buffered output, errors of stream are ignored here, call flush to see them
+        /// </summary>
+        ~AxisWriter() {
+            try {
+                flush();
+            } catch (...) {
+            }
+        }
+
+        /// <summary>
+        /// Get format of output
+        /// </summary>
+        /// <returns>format</returns>
+        AxisFormat getFormat() const {
+            return m_format;
+        }
+
+        /// <summary>
+        /// Write axes of one polygon
+        /// </summary>
+        /// <typeparam name="T">type of coords</typeparam>
+        /// <param name="label">name of polygon, empty label is not written in text format</param>
+        /// <param name="axes">axes of symmetry of polygon</param>
+        template <class T>
+        void write(std::string_view label, const std::vector<Axis<T>>& axes) {
+            switch (m_format) {
+                case AxisFormat::Text:
+                    writeText(label, axes);
+                    break;
+                case AxisFormat::Json:
+                    writeJson(label, axes);
+                    break;
+                case AxisFormat::Binary:
+                    writeBinary(label, axes);
+                    break;
+            }
+            if (m_buffer.size() >= m_bufferSize) {
+                writeBuffer();
+            }
+        }
+
+        /// <summary>
+        /// Write buffered output into stream and flush stream
+        /// </summary>
+        void flush() {
+            writeBuffer();
+            m_out.flush();
+            if (!m_out) {
+                throw std::runtime_error("Axes can not be written");
+            }
+        }
+    private:
+        template <class T>
+        void writeText(std::string_view label, const std::vector<Axis<T>>& axes) {
+            if (!label.empty()) {
+                m_buffer += label;
+                m_buffer += ":\n";
+            }
+            if (axes.empty()) {
+                m_buffer += "non-symmetric\n";
+            }
+            for (const auto& axis : axes) {
+                appendPoint(axis.getStart());
+                m_buffer += " - ";
+                appendPoint(axis.getEnd());
+                m_buffer += '\n';
+            }
+        }
+
+        template <class T>
+        void writeJson(std::string_view label, const std::vector<Axis<T>>& axes) {
+            m_buffer += "{\"label\":\"";
+            appendEscaped(label);
+            m_buffer += "\",\"axes\":[";
+            for (size_t i{}; i < axes.size(); ++i) {
+                m_buffer += i == 0 ? "[" : ",[";
+                appendShortest(double(axes[i].getStart().x));
+                m_buffer += ',';
+                appendShortest(double(axes[i].getStart().y));
+                m_buffer += ',';
+                appendShortest(double(axes[i].getEnd().x));
+                m_buffer += ',';
+                appendShortest(double(axes[i].getEnd().y));
+                m_buffer += ']';
+            }
+            m_buffer += "]}\n";
+        }
+
+        template <class T>
+        void writeBinary(std::string_view label, const std::vector<Axis<T>>& axes) {
+            if (!m_headerWritten) {
+                AxisStreamHeader header{};
+                std::memcpy(header.magic, AxisStreamHeader::kMagic, sizeof(header.magic));
+                header.version = AxisStreamHeader::kVersion;
+                header.byteOrder = AxisStreamHeader::kByteOrder;
+                appendBytes(&header, sizeof(header));
+                m_headerWritten = true;
+            }
+            uint32_t sizes[] { static_cast<uint32_t>(label.size()), static_cast<uint32_t>(axes.size()) };
+            appendBytes(sizes, sizeof(sizes));
+            m_buffer += label;
+            for (const auto& axis : axes) {
+                double coords[] { double(axis.getStart().x), double(axis.getStart().y), double(axis.getEnd().x), double(axis.getEnd().y) };
+                appendBytes(coords, sizeof(coords));
+            }
+        }
+
+        /// <summary>
+        /// Append point like Point2::toString: std::to_string uses %f, so it is fixed format with 6 digits
+        /// </summary>
+        template <class T>
+        void appendPoint(const Point2<T>& p) {
+            m_buffer += '(';
+            appendFixed(double(p.x));
+            m_buffer += ", ";
+            appendFixed(double(p.y));
+            m_buffer += ')';
+        }
+
+        void appendFixed(double value) {
+            char text[384];
+            auto result { std::to_chars(text, text + sizeof(text), value, std::chars_format::fixed, 6) };
+            m_buffer.append(text, result.ptr);
+        }
+
+        /// <summary>
+        /// Append shortest string that is read back exactly, JSON has no nan and inf, they are null
+        /// </summary>
+        void appendShortest(double value) {
+            if (!std::isfinite(value)) {
+                m_buffer += "null";
+                return;
+            }
+            char text[32];
+            auto result { std::to_chars(text, text + sizeof(text), value) };
+            m_buffer.append(text, result.ptr);
+        }
+
+        void appendEscaped(std::string_view text) {
+            static const char digits[] { "0123456789abcdef" };
+            for (char c : text) {
+                if (c == '"' || c == '\\') {
+                    m_buffer += '\\';
+                    m_buffer += c;
+                } else if (static_cast<unsigned char>(c) < 0x20) {
+                    m_buffer += "\\u00";
+                    m_buffer += digits[c >> 4];
+                    m_buffer += digits[c & 0xF];
+                } else {
+                    m_buffer += c;
+                }
+            }
+        }
+
+        void appendBytes(const void* data, size_t size) {
+            m_buffer.append(static_cast<const char*>(data), size);
+        }
+
+        void writeBuffer() {
+            if (!m_buffer.empty()) {
+                m_out.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+                m_buffer.clear();
+            }
+        }
+
+        std::ostream& m_out;
+        AxisFormat m_format;
+        size_t m_bufferSize;
+        std::string m_buffer{};
+        bool m_headerWritten{};
+};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Point2.hpp"
+#include "PointIndex.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+/// <summary>
+/// Fast rejection of candidate axis by small random sample of nodes.
+/// If line is axis of symmetry, reflection of every node is equal to some node,
+/// so candidate is rejected when reflection of any sampled node has no equal node.
+/// Lookup uses PointIndex, so it takes expected O(1) per sampled node.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class CandidateProbe {
+    public:
+        /// <summary>
+        /// base constructor, probe must be built before use
+        /// </summary>
+        CandidateProbe() {}
+
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="nodes">nodes of polygon with center in (0, 0)</param>
+        /// <param name="index">index over nodes, it must live longer than probe</param>
+        /// <param name="count">count of sampled nodes</param>
+        /// <param name="seed">seed of random generator</param>
+        template <class Nodes>
+        CandidateProbe(const Nodes& nodes, const PointIndex<T>& index, size_t count, unsigned seed = 0) {
+            build(nodes, index, count, seed);
+        }
+
+        /// <summary>
+        /// Sample nodes, memory of previous build is reused
+        /// </summary>
+        /// <param name="nodes">nodes of polygon with center in (0, 0)</param>
+        /// <param name="index">index over nodes, it must live longer than probe</param>
+        /// <param name="count">count of sampled nodes</param>
+        /// <param name="seed">seed of random generator</param>
+        template <class Nodes>
+        void build(const Nodes& nodes, const PointIndex<T>& index, size_t count, unsigned seed = 0) {
+            m_index = &index;
+            m_samples.clear();
+            auto size { nodes.size() };
+            if (size == 0) {
+                return;
+            }
+            std::mt19937 gen(seed);
+            std::uniform_int_distribution<size_t> pick(0, size - 1);
+            for (size_t i{}; i < std::min(count, size); ++i) {
+                m_samples.push_back(nodes[count < size ? pick(gen) : i]);
+            }
+        }
+
+        /// <summary>
+        /// Get count of sampled nodes
+        /// </summary>
+        /// <returns>count of samples</returns>
+        size_t size() const {
+            return m_samples.size();
+        }
+
+        /// <summary>
+        /// Check sampled nodes against candidate axis
+        /// </summary>
+        /// <param name="direction">unit direction of axis through (0, 0)</param>
+        /// <returns>false if line is surely not axis of symmetry else true</returns>
+        bool mayBeAxis(const Point2<T>& direction) const {
+            for (const auto& sample : m_samples) {
+                T twoDot { 2 * (sample.x * direction.x + sample.y * direction.y) };
+                if (!m_index->contains(Point2<T>(twoDot * direction.x - sample.x, twoDot * direction.y - sample.y))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    private:
+        const PointIndex<T>* m_index{};
+        std::vector<Point2<T>> m_samples;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+/// <summary>
+/// Axis of symmetry stored by positions of two elements of polygon that lie on it.
+/// Position 2i is node i, position 2i + 1 is middle of edge (i, i + 1), like in EdgeAngleSequence.
+/// It takes 8 bytes instead of two points of Axis, endpoints are built from nodes
+/// of polygon only when they are needed (SymmetryFinder::toAxes).
+/// </summary>
+struct CompactAxis {
+    uint32_t first;
+    uint32_t second;
+
+    friend bool operator==(const CompactAxis& a, const CompactAxis& b) {
+        return a.first == b.first && a.second == b.second;
+    }
+};
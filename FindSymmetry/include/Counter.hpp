@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+/// <summary>
+/// Event counter that can be increased from many threads.
+/// Unlike std::atomic it can be copied, so classes with counters stay copyable.
+/// </summary>
+class Counter {
+    public:
+        /// <summary>
+        /// base constructor
+        /// </summary>
+        Counter() {}
+
+        /// <summary>
+        /// Copy constructor
+        /// </summary>
+        /// <param name="counter">copied counter</param>
+        Counter(const Counter& counter) : m_value(counter.get()) {}
+
+        Counter& operator=(const Counter& counter) {
+            m_value.store(counter.get(), std::memory_order_relaxed);
+            return *this;
+        }
+
+        /// <summary>
+        /// Increase counter
+        /// </summary>
+        /// <param name="value">added value</param>
+        void add(size_t value = 1) {
+            m_value.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        /// <summary>
+        /// Get current value
+        /// </summary>
+        /// <returns>value of counter</returns>
+        size_t get() const {
+            return m_value.load(std::memory_order_relaxed);
+        }
+
+        /// <summary>
+        /// Set counter to 0
+        /// </summary>
+        void reset() {
+            m_value.store(0, std::memory_order_relaxed);
+        }
+    private:
+        std::atomic<size_t> m_value{};
+};
@@ -0,0 +1,365 @@
+#pragma once
+
+#include "Point2.hpp"
+#include "Polygon.hpp"
+#include "PolygonView.hpp"
+#include "Axis.hpp"
+#include "Fft.hpp"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <numbers>
+#include <type_traits>
+#include <vector>
+
+/// <summary>
+/// Axes of symmetry of closed curve that is sampled by polygon with irregular spacing of nodes.
+/// Curve is resampled by arc length into complex signal z[j] = P(jL / M) - c around centroid c.
+/// Reflection across line through c with angle phi maps point z to e^(2 i phi) conj(z) and keeps
+/// arc length, so axis through P(a) with 2a = kL / M pairs z[j] with z[(k - j) mod M] and
+/// conv[k] = sum z[j] z[k - j] = e^(2 i phi) sum |z|^2. For any curve relative RMS error of best
+/// line for shift k is sqrt(2 (1 - |conv[k]| / sum |z|^2)) and angle of line is arg(conv[k]) / 2,
+/// so all shifts are scored by one FFT self-convolution in O(M log M).
+/// Axes can be refined against original nodes: end of axis is searched between shifts and error
+/// is measured by nodes and points of original polygon in O(N) per step. Only K best peaks of score
+/// are refined, so refinement costs O(K N) in total; other peaks are accepted at precision of sampling.
+/// Nearly round curves have peak at almost every shift, so without the limit cost would be O(M N).
+/// </summary>
+/// <typeparam name="T">floating point type</typeparam>
+template <class T>
+class CurveSymmetry {
+    static_assert(std::is_floating_point_v<T>, "Curve symmetry needs floating point coords");
+    public:
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="sampleCount">count of samples, it is rounded up to power of 2</param>
+        explicit CurveSymmetry(size_t sampleCount = 1024) {
+            setSampleCount(sampleCount);
+        }
+
+        /// <summary>
+        /// Get count of samples of signal
+        /// </summary>
+        /// <returns>count of samples</returns>
+        size_t getSampleCount() const {
+            return m_sampleCount;
+        }
+
+        /// <summary>
+        /// Set count of samples of signal
+        /// </summary>
+        /// <param name="count">count of samples, it is rounded up to power of 2 not less than 16</param>
+        void setSampleCount(size_t count) {
+            m_sampleCount = 16;
+            while (m_sampleCount < count) {
+                m_sampleCount <<= 1;
+            }
+        }
+
+        /// <summary>
+        /// Check that axes are refined against original nodes
+        /// </summary>
+        /// <returns>true if axes are refined else false</returns>
+        bool getRefine() const {
+            return m_refine;
+        }
+
+        /// <summary>
+        /// Set refinement of axes against original nodes. Without refinement axes are as exact as
+        /// sampling, so tolerance must not be less than about pi / count of samples
+        /// </summary>
+        /// <param name="refine">true if axes are refined</param>
+        void setRefine(bool refine) {
+            m_refine = refine;
+        }
+
+        /// <summary>
+        /// Get max count of peaks that are refined against original nodes
+        /// </summary>
+        /// <returns>count of peaks</returns>
+        size_t getRefineCount() const {
+            return m_refineCount;
+        }
+
+        /// <summary>
+        /// Set max count of peaks that are refined against original nodes, every refinement costs
+        /// about 34 passes over nodes. Peaks with lower score are checked by score of sampling only
+        /// </summary>
+        /// <param name="count">count of peaks</param>
+        void setRefineCount(size_t count) {
+            m_refineCount = count;
+        }
+
+        /// <summary>
+        /// Find axes of symmetry of curve
+        /// </summary>
+        /// <param name="p">polygon that samples curve</param>
+        /// <param name="tolerance">max RMS reflection error relative to RMS distance from centroid</param>
+        /// <returns>vector with axes of symmetry</returns>
+        std::vector<Axis<T>> findSymmetry(const Polygon<T>& p, double tolerance) const {
+            return findSymmetry(PolygonView<T>(p), tolerance);
+        }
+
+        /// <summary>
+        /// Find axes of symmetry of curve that is not owned
+        /// </summary>
+        /// <param name="p">view of polygon that samples curve</param>
+        /// <param name="tolerance">max RMS reflection error relative to RMS distance from centroid</param>
+        /// <returns>vector with axes of symmetry</returns>
+        std::vector<Axis<T>> findSymmetry(const PolygonView<T>& p, double tolerance) const {
+            std::vector<Axis<T>> axes{};
+            Curve curve { p };
+            if (p.size() < 3 || !(curve.length > 0)) {
+                return axes;
+            }
+
+            // signal around centroid of curve
+            auto count { m_sampleCount };
+            double step { curve.length / count };
+            std::vector<std::complex<double>> signal(count);
+            double energy{};
+            curve.walk(0, step, count, [&](size_t j, const Point2<double>& point) {
+                signal[j] = { point.x - curve.center.x, point.y - curve.center.y };
+                energy += std::norm(signal[j]);
+            });
+            if (!(energy > 0)) {
+                return axes;
+            }
+            selfConvolve(signal);
+
+            // shifts are local maxima of score, refinement looks between shifts
+            double screen { m_refine ? tolerance + 2 * std::numbers::pi / count : tolerance };
+            std::vector<double> scores(count);
+            for (size_t k{}; k < count; ++k) {
+                scores[k] = std::abs(signal[k]) / energy;
+            }
+            // plateau of equal scores gives one peak
+            std::vector<size_t> peaks{};
+            for (size_t k{}; k < count; ++k) {
+                double score { scores[k] }, left { scores[k > 0 ? k - 1 : count - 1] };
+                if (score < left || (score == left && k > 0) || score < scores[k + 1 < count ? k + 1 : 0] ||
+                    getError(score) > screen) {
+                    continue;
+                }
+                peaks.push_back(k);
+            }
+
+            // best peaks are refined, others must pass tolerance on samples
+            size_t refineCount { m_refine ? std::min(m_refineCount, peaks.size()) : 0 };
+            std::partial_sort(peaks.begin(), peaks.begin() + refineCount, peaks.end(),
+                [&scores](size_t a, size_t b) { return scores[a] > scores[b]; });
+            std::vector<std::pair<double, double>> found{};
+            for (size_t i{}; i < peaks.size(); ++i) {
+                auto k { peaks[i] };
+                double a { k * step / 2 };
+                double angle { std::arg(signal[k]) / 2 };
+                if (i < refineCount) {
+                    auto refined { curve.refine(a - step / 2, a + step / 2) };
+                    if (refined.error > tolerance) {
+                        continue;
+                    }
+                    a = refined.a;
+                    angle = refined.angle;
+                } else if (getError(scores[k]) > tolerance) {
+                    continue;
+                }
+                found.push_back({ a, angle });
+            }
+
+            // neighbour shifts of one axis can be refined to the same end, a and a + L / 2 are the same axis
+            std::sort(found.begin(), found.end());
+            for (size_t i{}; i < found.size(); ++i) {
+                double gap { i + 1 < found.size() ? found[i + 1].first - found[i].first
+                                                  : found[0].first + curve.length / 2 - found[i].first };
+                if (found.size() > 1 && gap < step / 4) {
+                    continue;
+                }
+                axes.push_back(curve.getAxis(found[i].first, found[i].second));
+            }
+            return axes;
+        }
+    private:
+        /// <summary>
+        /// Relative RMS error of best line from score of shift
+        /// </summary>
+        static double getError(double score) {
+            return std::sqrt(std::max(0.0, 2 * (1 - score)));
+        }
+
+        /// <summary>
+        /// Original polygon parametrized by arc length
+        /// </summary>
+        struct Curve {
+            struct Refined {
+                double a;
+                double angle;
+                double error;
+            };
+
+            /// <summary>
+            /// Init constructor, finds arc lengths, centroid and weights of nodes
+            /// </summary>
+            /// <param name="p">view of polygon</param>
+            explicit Curve(const PolygonView<T>& p) : nodes(p), lengths(p.size() + 1) {
+                auto size { p.size() };
+                for (size_t i{}; i < size; ++i) {
+                    auto a { get(i) }, b { get(i + 1 < size ? i + 1 : 0) };
+                    double edge { std::hypot(b.x - a.x, b.y - a.y) };
+                    lengths[i + 1] = lengths[i] + edge;
+                    center += (a + b) * (edge / 2);
+                }
+                length = lengths[size];
+                if (length > 0) {
+                    center /= length;
+                }
+            }
+
+            Point2<double> get(size_t i) const {
+                auto node { nodes[i] };
+                return Point2<double>(node.x, node.y);
+            }
+
+            /// <summary>
+            /// Get point of curve on edge
+            /// </summary>
+            /// <param name="edge">index of edge that contains s</param>
+            /// <param name="s">arc length</param>
+            Point2<double> getPoint(size_t edge, double s) const {
+                auto size { nodes.size() };
+                auto a { get(edge) }, b { get(edge + 1 < size ? edge + 1 : 0) };
+                double edgeLength { lengths[edge + 1] - lengths[edge] };
+                double t { edgeLength > 0 ? (s - lengths[edge]) / edgeLength : 0 };
+                return a + (b - a) * t;
+            }
+
+            /// <summary>
+            /// Get edge that contains arc length
+            /// </summary>
+            size_t findEdge(double s) const {
+                auto size { nodes.size() };
+                auto edge { static_cast<size_t>(std::upper_bound(lengths.begin(), lengths.begin() + size, s) - lengths.begin()) };
+                return edge > 0 ? edge - 1 : 0;
+            }
+
+            /// <summary>
+            /// Visit points at arc lengths start + j * step for j in [0, count)
+            /// </summary>
+            template <class Visit>
+            void walk(double start, double step, size_t count, Visit visit) const {
+                auto size { nodes.size() };
+                auto edge { findEdge(start) };
+                bool wrapped{};
+                for (size_t j{}; j < count; ++j) {
+                    double s { start + j * step };
+                    if (s >= length) {
+                        s -= length;
+                        if (!wrapped) {
+                            wrapped = true;
+                            edge = 0;
+                        }
+                    }
+                    while (edge + 1 < size && lengths[edge + 1] <= s) {
+                        ++edge;
+                    }
+                    visit(j, getPoint(edge, s));
+                }
+            }
+
+            /// <summary>
+            /// Find best line for axis with end at arc length a: node at s is paired with point at 2a - s.
+            /// Weight of node is half of its edges, so error does not depend on spacing of nodes
+            /// </summary>
+            /// <param name="a">arc length of end of axis</param>
+            /// <returns>angle of line and relative RMS error</returns>
+            Refined fit(double a) const {
+                auto size { nodes.size() };
+                double twoA { std::fmod(2 * a, length) };
+                if (twoA < 0) {
+                    twoA += length;
+                }
+
+                std::complex<double> sum{};
+                double energy{}, pairEnergy{};
+                auto edge { findEdge(twoA) };
+                bool wrapped{};
+                for (size_t i{}; i < size; ++i) {
+                    double s { twoA - lengths[i] };
+                    if (s < 0) {
+                        s += length;
+                        if (!wrapped) {
+                            wrapped = true;
+                            edge = size - 1;
+                        }
+                    }
+                    while (edge > 0 && s < lengths[edge]) {
+                        --edge;
+                    }
+                    double weight { (lengths[i + 1] - lengths[i] + (i > 0 ? lengths[i] - lengths[i - 1] : length - lengths[size - 1])) / 2 };
+                    auto u { get(i) - center }, q { getPoint(edge, s) - center };
+                    sum += weight * std::complex<double>(q.x, q.y) * std::complex<double>(u.x, u.y);
+                    energy += weight * (u.x * u.x + u.y * u.y);
+                    pairEnergy += weight * (q.x * q.x + q.y * q.y);
+                }
+                if (!(energy > 0)) {
+                    return Refined{ a, 0, HUGE_VAL };
+                }
+                double error { std::sqrt(std::max(0.0, (energy + pairEnergy - 2 * std::abs(sum)) / energy)) };
+                return Refined{ a, std::arg(sum) / 2, error };
+            }
+
+            /// <summary>
+            /// Find end of axis in [left, right] with smallest error by golden section search
+            /// </summary>
+            Refined refine(double left, double right) const {
+                double ratio { (std::sqrt(5.0) - 1) / 2 };
+                double x1 { right - ratio * (right - left) }, x2 { left + ratio * (right - left) };
+                auto f1 { fit(x1) }, f2 { fit(x2) };
+                for (int i{}; i < 32; ++i) {
+                    if (f1.error < f2.error) {
+                        right = x2;
+                        x2 = x1;
+                        f2 = f1;
+                        x1 = right - ratio * (right - left);
+                        f1 = fit(x1);
+                    } else {
+                        left = x1;
+                        x1 = x2;
+                        f1 = f2;
+                        x2 = left + ratio * (right - left);
+                        f2 = fit(x2);
+                    }
+                }
+                auto best { f1.error < f2.error ? f1 : f2 };
+                best.a = std::fmod(best.a, length / 2);
+                if (best.a < 0) {
+                    best.a += length / 2;
+                }
+                return best;
+            }
+
+            /// <summary>
+            /// Build axis through centroid, its ends are points of curve at a and a + L / 2 projected on line
+            /// </summary>
+            Axis<T> getAxis(double a, double angle) const {
+                Point2<double> direction { std::cos(angle), std::sin(angle) };
+                auto end = [&](double s) {
+                    s = std::fmod(s, length);
+                    auto point { getPoint(findEdge(s), s) - center };
+                    double projection { point.x * direction.x + point.y * direction.y };
+                    return Point2<T>(T(center.x + projection * direction.x), T(center.y + projection * direction.y));
+                };
+                return Axis<T>(end(a), end(a + length / 2));
+            }
+
+            PolygonView<T> nodes;
+            std::vector<double> lengths;
+            double length{};
+            Point2<double> center{};
+        };
+
+        size_t m_sampleCount{ 1024 };
+        size_t m_refineCount{ 32 };
+        bool m_refine{ true };
+};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+/// <summary>
+/// Compute prefix function (KMP failure function) of pattern
+/// </summary>
+/// <typeparam name="Token">type of sequence element</typeparam>
+/// <typeparam name="Equal">predicate that compares two tokens</typeparam>
+/// <param name="pattern">sequence of tokens</param>
+/// <param name="equal">compare predicate</param>
+/// <param name="prefix">output: prefix[i] is length of longest proper border of pattern[0..i]</param>
+template <class Token, class Equal>
+void computePrefixFunction(const std::vector<Token>& pattern, Equal equal, std::vector<size_t>& prefix) {
+    auto size { pattern.size() };
+    prefix.assign(size, 0);
+
+    for (size_t i { 1 }; i < size; ++i) {
+        size_t k { prefix[i - 1] };
+        while (k > 0 && !equal(pattern[i], pattern[k])) {
+            k = prefix[k - 1];
+        }
+        if (equal(pattern[i], pattern[k])) {
+            ++k;
+        }
+        prefix[i] = k;
+    }
+}
+
+/// <summary>
+/// Find all cyclic shifts of text that are equal to pattern.
+/// Shift m is found if pattern[i] == text[(m + i) % n] for all i.
+/// Works in O(n) with precomputed prefix function of pattern.
+/// </summary>
+/// <typeparam name="Token">type of sequence element</typeparam>
+/// <typeparam name="Equal">predicate that compares two tokens</typeparam>
+/// <param name="pattern">sequence of tokens</param>
+/// <param name="prefix">prefix function of pattern</param>
+/// <param name="text">sequence with same size as pattern</param>
+/// <param name="equal">compare predicate</param>
+/// <param name="shifts">output: found shifts in range [0, n)</param>
+template <class Token, class Equal>
+void findCyclicShifts(const std::vector<Token>& pattern, const std::vector<size_t>& prefix,
+                      const std::vector<Token>& text, Equal equal, std::vector<size_t>& shifts) {
+    shifts.clear();
+    auto size { pattern.size() };
+    if (size == 0 || text.size() != size) {
+        return;
+    }
+
+    // scan text concatenated with itself without last token
+    size_t k {};
+    for (size_t i {}; i < 2 * size - 1; ++i) {
+        const Token& token { text[i < size ? i : i - size] };
+        while (k > 0 && !equal(token, pattern[k])) {
+            k = prefix[k - 1];
+        }
+        if (equal(token, pattern[k])) {
+            ++k;
+        }
+        if (k == size) {
+            shifts.push_back(i + 1 - size);
+            k = prefix[k - 1];
+        }
+    }
+}
+
+/// <summary>
+/// Find all cyclic shifts of text that are equal to pattern
+/// </summary>
+/// <typeparam name="Token">type of sequence element</typeparam>
+/// <typeparam name="Equal">predicate that compares two tokens</typeparam>
+/// <param name="pattern">sequence of tokens</param>
+/// <param name="text">sequence with same size as pattern</param>
+/// <param name="equal">compare predicate</param>
+/// <returns>found shifts in range [0, n)</returns>
+template <class Token, class Equal>
+std::vector<size_t> findCyclicShifts(const std::vector<Token>& pattern, const std::vector<Token>& text, Equal equal) {
+    std::vector<size_t> prefix{};
+    std::vector<size_t> shifts{};
+    computePrefixFunction(pattern, equal, prefix);
+    findCyclicShifts(pattern, prefix, text, equal, shifts);
+    return shifts;
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "Point2.hpp"
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+/// <summary>
+/// Element of cyclic edge/angle sequence.
+/// Vertex token describes turn in vertex by chord between neighbours and signed
+/// distance from vertex to this chord. Edge token describes length of edge.
+/// Both values have dimension of length, so they are compared like coordinates.
+/// For integer coords vertex token is exact (dot, cross) of in and out edges
+/// and edge token is squared length, they are compared without epsilon.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+struct SequenceToken {
+    bool isVertex;
+    T first, second;
+
+    /// <summary>
+    /// Compare 2 tokens with presision epsilon
+    /// </summary>
+    /// <param name="token">token for compare</param>
+    /// <param name="epsilon">presision</param>
+    /// <returns>true if this token is equal token else false</returns>
+    bool isEqual(const SequenceToken& token, double epsilon) const {
+        return isVertex == token.isVertex &&
+               Point2<T>::equalValues(first, token.first, epsilon) &&
+               Point2<T>::equalValues(second, token.second, epsilon);
+    }
+};
+
+/// <summary>
+/// Cyclic sequence V0 E0 V1 E1 ... V(n-1) E(n-1) of polygon, where Vi is token of vertex i
+/// and Ei is token of edge (i, i + 1). Position 2i is vertex i, position 2i + 1 is edge i.
+/// Sequence is invariant to translation and rotation of polygon, and reflected polygon
+/// traversed in back order gives the same sequence.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class EdgeAngleSequence {
+    public:
+        /// <summary>
+        /// base constructor
+        /// </summary>
+        EdgeAngleSequence() {}
+
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="nodes">nodes of polygon</param>
+        template <class Nodes>
+        explicit EdgeAngleSequence(const Nodes& nodes) {
+            build(nodes);
+        }
+
+        /// <summary>
+        /// Encode polygon as sequence of tokens
+        /// </summary>
+        /// <param name="nodes">nodes of polygon</param>
+        template <class Nodes>
+        void build(const Nodes& nodes) {
+            auto size { nodes.size() };
+            m_tokens.resize(2 * size);
+
+            for (size_t i {}; i < size; ++i) {
+                updateVertex(nodes, i);
+            }
+        }
+
+        /// <summary>
+        /// Update tokens after node was moved. Only tokens of node, its neighbours
+        /// and edges of node depend on it, so update takes O(1)
+        /// </summary>
+        /// <param name="nodes">nodes of polygon with moved node</param>
+        /// <param name="index">index of moved node</param>
+        template <class Nodes>
+        void move(const Nodes& nodes, size_t index) {
+            auto size { nodes.size() };
+            updateVertex(nodes, (index + size - 1) % size);
+            updateVertex(nodes, index);
+            updateVertex(nodes, (index + 1) % size);
+        }
+
+        /// <summary>
+        /// Update tokens after node was inserted
+        /// </summary>
+        /// <param name="nodes">nodes of polygon with inserted node</param>
+        /// <param name="index">index of inserted node</param>
+        template <class Nodes>
+        void insert(const Nodes& nodes, size_t index) {
+            m_tokens.insert(m_tokens.begin() + 2 * index, 2, SequenceToken<T>{});
+            move(nodes, index);
+        }
+
+        /// <summary>
+        /// Update tokens after node was erased
+        /// </summary>
+        /// <param name="nodes">nodes of polygon without erased node</param>
+        /// <param name="index">index of erased node</param>
+        template <class Nodes>
+        void erase(const Nodes& nodes, size_t index) {
+            m_tokens.erase(m_tokens.begin() + 2 * index, m_tokens.begin() + 2 * index + 2);
+            auto size { nodes.size() };
+            if (size > 0) {
+                updateVertex(nodes, (index + size - 1) % size);
+                updateVertex(nodes, index % size);
+            }
+        }
+
+        /// <summary>
+        /// Get all tokens of sequence
+        /// </summary>
+        /// <returns>readonly tokens</returns>
+        const std::vector<SequenceToken<T>>& getTokens() const {
+            return m_tokens;
+        }
+
+        /// <summary>
+        /// Get sequence in back order: reversed[q] = tokens[-q mod 2n]
+        /// </summary>
+        /// <param name="reversed">output sequence</param>
+        void getReversed(std::vector<SequenceToken<T>>& reversed) const {
+            auto size { m_tokens.size() };
+            reversed.resize(size);
+
+            for (size_t q {}; q < size; ++q) {
+                reversed[q] = m_tokens[q == 0 ? 0 : size - q];
+            }
+        }
+
+        /// <summary>
+        /// Get position of first element on axis that is given by matched shift of reversed sequence.
+        /// Pattern[i] == reversed[i + shift] means reflection q -> (-shift - q) mod 2N,
+        /// so axis passes through elements k / 2 and k / 2 + N, where k = -shift mod 2N
+        /// </summary>
+        /// <param name="size">count of nodes</param>
+        /// <param name="shift">matched shift</param>
+        /// <returns>position in sequence</returns>
+        static size_t getAxisPosition(size_t size, size_t shift) {
+            return (2 * size - shift) % (2 * size) / 2;
+        }
+
+        /// <summary>
+        /// Get point of sequence element: vertex for even position and middle of edge for odd
+        /// </summary>
+        /// <param name="nodes">nodes of polygon</param>
+        /// <param name="position">position in sequence</param>
+        /// <returns>point of element</returns>
+        template <class Nodes>
+        static Point2<RealOf<T>> getElementPoint(const Nodes& nodes, size_t position) {
+            using Real = RealOf<T>;
+            auto index { position / 2 };
+            Point2<T> node { nodes[index] };
+            Point2<Real> point { Real(node.x), Real(node.y) };
+            if (position % 2 == 0) {
+                return point;
+            }
+            Point2<T> next { nodes[index + 1 == nodes.size() ? 0 : index + 1] };
+            return (point + Point2<Real>(Real(next.x), Real(next.y))) / 2.0;
+        }
+    private:
+        /// <summary>
+        /// Compute token of vertex i and token of edge (i, i + 1)
+        /// </summary>
+        template <class Nodes>
+        void updateVertex(const Nodes& nodes, size_t i) {
+            auto size { nodes.size() };
+            Point2<T> prev { nodes[i == 0 ? size - 1 : i - 1] },
+                      node { nodes[i] },
+                      next { nodes[i + 1 == size ? 0 : i + 1] };
+            auto in { node - prev }, out { next - node };
+
+            if constexpr (std::is_integral_v<T>) {
+                // |coord| <= 2^30, so differences are less than 2^31 and sums of products less than 2^63
+                constexpr T limit { T(1) << 30 };
+                if (node.x > limit || node.x < -limit || node.y > limit || node.y < -limit) {
+                    throw std::runtime_error("Integer coords must be in range [-2^30, 2^30]");
+                }
+                m_tokens[2 * i] = { true, in.dot(out), in.cross(out) };
+                m_tokens[2 * i + 1] = { false, out.dot(out), T{} };
+            } else {
+                auto chord { next - prev };
+                T chordLength { std::sqrt(chord.x * chord.x + chord.y * chord.y) };
+                T cross { in.x * out.y - in.y * out.x };
+
+                m_tokens[2 * i] = { true, chordLength, chordLength == 0 ? T{} : cross / chordLength };
+                m_tokens[2 * i + 1] = { false, std::sqrt(out.x * out.x + out.y * out.y), T{} };
+            }
+        }
+
+        std::vector<SequenceToken<T>> m_tokens;
+};
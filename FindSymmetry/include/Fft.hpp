@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <numbers>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// Check that size is power of 2
+/// </summary>
+/// <param name="size">size</param>
+/// <returns>true if size is power of 2 else false</returns>
+inline bool isPowerOfTwo(size_t size) {
+    return size != 0 && (size & (size - 1)) == 0;
+}
+
+/// <summary>
+/// In-place iterative radix-2 fast Fourier transform in O(M log M).
+/// Forward transform is X[k] = sum x[j] e^(-2 pi i jk / M), inverse transform is divided by M
+/// </summary>
+/// <param name="values">signal, size must be power of 2</param>
+/// <param name="inverse">true for inverse transform</param>
+inline void fft(std::vector<std::complex<double>>& values, bool inverse = false) {
+    auto size { values.size() };
+    if (!isPowerOfTwo(size)) {
+        throw std::runtime_error("Size of FFT must be power of 2");
+    }
+
+    // bit reversal permutation
+    for (size_t i{ 1 }, j{}; i < size; ++i) {
+        size_t bit { size >> 1 };
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(values[i], values[j]);
+        }
+    }
+
+    for (size_t length{ 2 }; length <= size; length <<= 1) {
+        double angle { 2 * std::numbers::pi / length * (inverse ? 1 : -1) };
+        std::complex<double> root { std::cos(angle), std::sin(angle) };
+        for (size_t start{}; start < size; start += length) {
+            std::complex<double> w { 1 };
+            for (size_t k{}; k < length / 2; ++k) {
+                auto even { values[start + k] }, odd { values[start + k + length / 2] * w };
+                values[start + k] = even + odd;
+                values[start + k + length / 2] = even - odd;
+                w *= root;
+            }
+        }
+    }
+
+    if (inverse) {
+        for (auto& value : values) {
+            value /= double(size);
+        }
+    }
+}
+
+/// <summary>
+/// Circular self-convolution c[k] = sum x[j] x[(k - j) mod M] by FFT in O(M log M)
+/// </summary>
+/// <param name="values">signal, size must be power of 2, output: convolution</param>
+inline void selfConvolve(std::vector<std::complex<double>>& values) {
+    fft(values);
+    for (auto& value : values) {
+        value *= value;
+    }
+    fft(values, true);
+}
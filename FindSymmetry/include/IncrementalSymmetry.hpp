@@ -0,0 +1,309 @@
+#pragma once
+
+#include "Polygon.hpp"
+#include "Axis.hpp"
+#include "EdgeAngleSequence.hpp"
+#include "CyclicMatcher.hpp"
+#include "CompactAxis.hpp"
+#include "AxisVerifier.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+/// <summary>
+/// Axes of symmetry of polygon that is edited by single nodes.
+/// Edge/angle sequence and its reverse are cached: move of node changes O(1) tokens,
+/// insert and erase shift tokens in O(N).
+/// Move of node keeps current axes and checks only pairs that involve changed tokens and moved
+/// node, O(1) per axis, so O(K) for K axes. Axis set can grow only if moved node gets a mirror:
+/// vertex with equal vertex token and swapped edge tokens. Vertices are kept in ordered index by
+/// their chords, so such mirrors are found in O(log N), and only when mirror gives axis that is not
+/// current axis (or both ends of axis depend on moved node) whole KMP over cached sequences runs again
+/// with check of matched axes by positions of nodes (AxisVerifier), O(N).
+/// Insert and erase renumber nodes, so they always recompute axes and index in O(N log N).
+/// Polygon is never simplified, so axes are the same as SymmetryFinder with Linear engine
+/// and without simplification (setSimplifyThreshold) gives for current polygon.
+/// For integer T axes are matched exactly and returned in double like SymmetryFinder does.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class IncrementalSymmetry {
+    public:
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="p">polygon</param>
+        /// <param name="epsilon">presision</param>
+        IncrementalSymmetry(Polygon<T> p, double epsilon) : m_polygon(std::move(p)), m_epsilon(epsilon) {
+            m_sequence.build(m_polygon.getNodes());
+            m_sequence.getReversed(m_reversed);
+            buildIndex();
+            updateAxes();
+        }
+
+        /// <summary>
+        /// Get current polygon
+        /// </summary>
+        /// <returns>readonly polygon</returns>
+        const Polygon<T>& getPolygon() const {
+            return m_polygon;
+        }
+
+        /// <summary>
+        /// Get axes of symmetry of current polygon
+        /// </summary>
+        /// <returns>readonly axes</returns>
+        const std::vector<Axis<RealOf<T>>>& getAxes() const {
+            return m_axes;
+        }
+
+        /// <summary>
+        /// Get count of edits that found axes again for whole polygon
+        /// </summary>
+        /// <returns>count of full recomputes</returns>
+        size_t getRecomputeCount() const {
+            return m_recomputeCount;
+        }
+
+        /// <summary>
+        /// Move node and update axes, takes O(K + log N) for K axes if axis set does not grow else O(N)
+        /// </summary>
+        /// <param name="index">index of node</param>
+        /// <param name="p">new position of node</param>
+        void moveNode(size_t index, const Point2<T>& p) {
+            auto old { index < m_polygon.getNodes().size() ? m_polygon.getNodes()[index] : p };
+            m_polygon.setNode(index, p);
+            m_sum += p - old;
+            const auto& nodes { m_polygon.getNodes() };
+            m_sequence.move(nodes, index);
+
+            // reversed[q] = tokens[-q mod 2n], so only mirrors of changed tokens are updated
+            auto size { m_reversed.size() };
+            const auto& tokens { m_sequence.getTokens() };
+            for (size_t i{}; i < 6; ++i) {
+                auto position { (2 * index + size - 2 + i) % size };
+                m_reversed[(size - position) % size] = tokens[position];
+            }
+
+            auto count { nodes.size() };
+            for (size_t i{}; i < 3 && i < count; ++i) {
+                updateIndex((index + count - 1 + i) % count);
+            }
+            if (!updateAxesLocally(index)) {
+                updateAxes();
+            }
+        }
+
+        /// <summary>
+        /// Insert node before node with index and update axes, takes O(N log N) because axes are found again for whole polygon
+        /// </summary>
+        /// <param name="index">index of inserted node, count of nodes appends node</param>
+        /// <param name="p">inserted node</param>
+        void insertNode(size_t index, const Point2<T>& p) {
+            m_polygon.insertNode(index, p);
+            m_sequence.insert(m_polygon.getNodes(), index);
+            m_sequence.getReversed(m_reversed);
+            buildIndex();
+            updateAxes();
+        }
+
+        /// <summary>
+        /// Erase node and update axes, takes O(N log N) because axes are found again for whole polygon
+        /// </summary>
+        /// <param name="index">index of erased node</param>
+        void eraseNode(size_t index) {
+            m_polygon.eraseNode(index);
+            m_sequence.erase(m_polygon.getNodes(), index);
+            m_sequence.getReversed(m_reversed);
+            buildIndex();
+            updateAxes();
+        }
+    private:
+        using Index = std::multimap<T, size_t>;
+
+        /// <summary>
+        /// Find axes of whole polygon by KMP and check them by positions of nodes, O(N)
+        /// </summary>
+        void updateAxes() {
+            const auto& nodes { m_polygon.getNodes() };
+            auto size { nodes.size() };
+            ++m_recomputeCount;
+            m_axes.clear();
+            m_compact.clear();
+            m_isAxis.assign(size, false);
+            if (size < 3) {
+                return;
+            }
+
+            auto equal = [this](const SequenceToken<T>& a, const SequenceToken<T>& b) { return a.isEqual(b, m_epsilon); };
+            computePrefixFunction(m_sequence.getTokens(), equal, m_prefix);
+            findCyclicShifts(m_sequence.getTokens(), m_prefix, m_reversed, equal, m_shifts);
+
+            m_compact.clear();
+            for (auto shift : m_shifts) {
+                auto first { EdgeAngleSequence<T>::getAxisPosition(size, shift) };
+                m_compact.push_back(CompactAxis{ static_cast<uint32_t>(first), static_cast<uint32_t>(first + size) });
+            }
+            // the same check of matched axes by positions of nodes as in SymmetryFinder
+            if constexpr (!std::is_integral_v<T>) {
+                if (!m_compact.empty()) {
+                    m_verifier.build(nodes);
+                    m_verifier.verifyAxes(m_compact, m_epsilon);
+                }
+            }
+            for (const auto& axis : m_compact) {
+                m_isAxis[axis.first] = true;
+            }
+            buildAxes();
+        }
+
+        /// <summary>
+        /// Update axes after move of node without KMP over whole polygon
+        /// </summary>
+        /// <param name="index">index of moved node</param>
+        /// <returns>false if axis set can grow and axes must be found again else true</returns>
+        bool updateAxesLocally(size_t index) {
+            const auto& nodes { m_polygon.getNodes() };
+            const auto& tokens { m_sequence.getTokens() };
+            auto size { nodes.size() };
+            if (size < 3) {
+                return false;
+            }
+
+            // new axis must map moved vertex to vertex m: reflection maps position q to 2p - q,
+            // so vertex tokens are equal and edges around vertices are swapped
+            auto vertex { tokens[2 * index] };
+            auto [begin, end] { findVertices(vertex.first) };
+            for (auto it { begin }; it != end; ++it) {
+                auto m { it->second };
+                if (isPair(2 * index, 2 * m) && isPair(2 * index + 1, 2 * m + 2 * size - 1) &&
+                    isPair(2 * index + 2 * size - 1, 2 * m + 1) && !m_isAxis[(index + m) % size]) {
+                    return false;
+                }
+            }
+
+            // current axis stays only if changed tokens and moved node match their mirrors
+            auto twoSize { 2 * size };
+            auto touches = [&](size_t position) {
+                return (position + twoSize - 2 * index + 1) % twoSize <= 2;
+            };
+            for (const auto& axis : m_compact) {
+                if (touches(axis.first) && touches(axis.second)) {
+                    return false;
+                }
+            }
+            std::erase_if(m_compact, [&](const CompactAxis& axis) {
+                bool keep { true };
+                for (size_t k{}; k < 5 && keep; ++k) {
+                    auto position { (2 * index + twoSize - 2 + k) % twoSize };
+                    keep = isPair(position, 2 * axis.first + twoSize - position);
+                }
+                if constexpr (!std::is_integral_v<T>) {
+                    keep = keep && isMirror(axis, index, touches(axis.first) ? axis.second : axis.first);
+                }
+                if (!keep) {
+                    m_isAxis[axis.first] = false;
+                }
+                return !keep;
+            });
+            buildAxes();
+            return true;
+        }
+
+        /// <summary>
+        /// Check that tokens at positions are equal, positions are taken modulo 2N
+        /// </summary>
+        bool isPair(size_t a, size_t b) const {
+            const auto& tokens { m_sequence.getTokens() };
+            auto size { tokens.size() };
+            return tokens[a % size].isEqual(tokens[b % size], m_epsilon);
+        }
+
+        /// <summary>
+        /// Check that moved node reflected across axis is equal to its mirror, like AxisVerifier does
+        /// for all nodes. Axis passes through center of nodes and element that does not depend on moved node
+        /// </summary>
+        /// <param name="axis">checked axis</param>
+        /// <param name="index">index of moved node</param>
+        /// <param name="position">position of element on axis</param>
+        bool isMirror(const CompactAxis& axis, size_t index, size_t position) const {
+            const auto& nodes { m_polygon.getNodes() };
+            auto size { nodes.size() };
+            auto center { m_sum / static_cast<T>(size) };
+            auto point { EdgeAngleSequence<T>::getElementPoint(nodes, position) - center };
+            if (point.dot(point) == 0) {
+                return false;
+            }
+            auto direction { point.getNormalized() };
+            auto node { nodes[index] - center }, mirror { nodes[(axis.first + size - index) % size] - center };
+            return (direction * (2 * node.dot(direction)) - node).isEqual(mirror, m_epsilon);
+        }
+
+        /// <summary>
+        /// Get vertices whose chord can be equal to chord
+        /// </summary>
+        std::pair<typename Index::const_iterator, typename Index::const_iterator> findVertices(T chord) const {
+            if constexpr (std::is_integral_v<T>) {
+                return m_index.equal_range(chord);
+            } else {
+                // window of relative presision like in PointIndex
+                double width { m_epsilon < 1 ? m_epsilon * std::max(1.0, std::fabs(double(chord))) / (1 - m_epsilon) : HUGE_VAL };
+                return { m_index.lower_bound(T(chord - width)), m_index.upper_bound(T(chord + width)) };
+            }
+        }
+
+        /// <summary>
+        /// Build index of vertex chords and sum of nodes in O(N log N)
+        /// </summary>
+        void buildIndex() {
+            const auto& nodes { m_polygon.getNodes() };
+            const auto& tokens { m_sequence.getTokens() };
+            m_index.clear();
+            m_entries.clear();
+            m_sum = Point2<T>{};
+            for (size_t i{}; i < nodes.size(); ++i) {
+                m_entries.push_back(m_index.emplace(tokens[2 * i].first, i));
+                m_sum += nodes[i];
+            }
+        }
+
+        /// <summary>
+        /// Move vertex to its new chord in index
+        /// </summary>
+        void updateIndex(size_t i) {
+            auto chord { m_sequence.getTokens()[2 * i].first };
+            if (m_entries[i]->first != chord) {
+                m_index.erase(m_entries[i]);
+                m_entries[i] = m_index.emplace(chord, i);
+            }
+        }
+
+        /// <summary>
+        /// Build axes from compact axes
+        /// </summary>
+        void buildAxes() {
+            const auto& nodes { m_polygon.getNodes() };
+            m_axes.clear();
+            for (const auto& axis : m_compact) {
+                m_axes.push_back(Axis<RealOf<T>>(EdgeAngleSequence<T>::getElementPoint(nodes, axis.first),
+                                                 EdgeAngleSequence<T>::getElementPoint(nodes, axis.second)));
+            }
+        }
+
+        Polygon<T> m_polygon;
+        double m_epsilon;
+        EdgeAngleSequence<T> m_sequence;
+        std::vector<SequenceToken<T>> m_reversed;
+        std::vector<size_t> m_prefix, m_shifts;
+        std::vector<CompactAxis> m_compact;
+        std::vector<bool> m_isAxis;
+        AxisVerifier<T> m_verifier;
+        std::vector<Axis<RealOf<T>>> m_axes;
+        Index m_index;
+        std::vector<typename Index::iterator> m_entries;
+        Point2<T> m_sum{};
+        size_t m_recomputeCount{};
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Point2.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+/// <summary>
+/// Cheap necessary condition of reflection symmetry.
+/// Reflection maps node i to node (c - i), so radii of nodes, lengths of edges and
+/// chords of vertices (distance between neighbours, it describes turn in vertex) are split
+/// into pairs of equal values. Only elements that lie on axis have no pair, and axis
+/// crosses at most 2 vertices and at most 2 edges. If any multiset has more than 2 values
+/// without pair, polygon has no axis of symmetry.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class InvariantSignature {
+    public:
+        /// <summary>
+        /// Check necessary condition of reflection symmetry in O(N log N)
+        /// </summary>
+        /// <param name="nodes">nodes of polygon with center in (0, 0)</param>
+        /// <param name="epsilon">presision of coords</param>
+        /// <returns>false if polygon is surely non-symmetric else true</returns>
+        template <class Nodes>
+        bool maybeSymmetric(const Nodes& nodes, double epsilon) {
+            auto size { nodes.size() };
+            m_values.resize(size);
+
+            // values are derived from coords, so tolerance is taken from the biggest coord
+            T scale { 1 };
+            for (size_t i{}; i < size; ++i) {
+                Point2<T> node { nodes[i] };
+                scale = std::max({ scale, std::fabs(node.x), std::fabs(node.y) });
+            }
+            T tolerance { static_cast<T>(4 * epsilon) * scale };
+
+            for (size_t i{}; i < size; ++i) {
+                m_values[i] = length(nodes[i]);
+            }
+            if (!isPaired(tolerance)) {
+                return false;
+            }
+
+            for (size_t i{}; i < size; ++i) {
+                m_values[i] = length(Point2<T>(nodes[i + 1 == size ? 0 : i + 1]) - Point2<T>(nodes[i]));
+            }
+            if (!isPaired(tolerance)) {
+                return false;
+            }
+
+            for (size_t i{}; i < size; ++i) {
+                m_values[i] = length(Point2<T>(nodes[i + 1 == size ? 0 : i + 1]) - Point2<T>(nodes[i == 0 ? size - 1 : i - 1]));
+            }
+            return isPaired(tolerance);
+        }
+
+        /// <summary>
+        /// Get size of buffer of values
+        /// </summary>
+        /// <returns>count of bytes</returns>
+        size_t getMemorySize() const {
+            return m_values.capacity() * sizeof(T);
+        }
+    private:
+        static T length(const Point2<T>& p) {
+            return std::sqrt(p.x * p.x + p.y * p.y);
+        }
+
+        /// <summary>
+        /// Sort values and greedily pair neighbours
+        /// </summary>
+        /// <param name="tolerance">max difference of values in pair</param>
+        /// <returns>true if at most 2 values have no pair else false</returns>
+        bool isPaired(T tolerance) {
+            std::sort(m_values.begin(), m_values.end());
+
+            size_t single{};
+            for (size_t i{}; i < m_values.size(); ++i) {
+                if (i + 1 < m_values.size() && m_values[i + 1] - m_values[i] <= tolerance) {
+                    ++i;
+                } else if (++single > 2) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::vector<T> m_values;
+};
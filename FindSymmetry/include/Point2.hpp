@@ -2,6 +2,17 @@
 
 #include<string>
 #include<algorithm>
+#include<cmath>
+#include<stdexcept>
+#include<type_traits>
+
+/// <summary>
+/// Type of coords that are not exact in type T: middle of edge of integer polygon
+/// is half-integer, so it is stored as double
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <typename T>
+using RealOf = std::conditional_t<std::is_integral_v<T>, double, T>;
 
 /// <summary>
 /// This struct represents point in 2D plane (x, y)
@@ -87,13 +98,43 @@ struct Point2 {
     /// <param name="p">point for compare</param>
     /// <param name="epsilon">presision</param>
     /// <returns>true if this point is equal p else false</returns>
-    bool isEqual(Point2& p, double epsilon) {
+    bool isEqual(const Point2& p, double epsilon) const {
         return equalValues(x, p.x, epsilon) && equalValues(y, p.y, epsilon);
     }
 
-    bool equalValues(double a, double b, double epsilon) {
-        double max = std::max({ 1.0, std::fabs(a) , std::fabs(b) });
-        return std::fabs(a - b) <= epsilon * max;
+    /// <summary>
+    /// Compare 2 values with presision epsilon relative to max(1, |a|, |b|).
+    /// Integer values are compared exactly, epsilon is ignored
+    /// </summary>
+    /// <param name="a">first value</param>
+    /// <param name="b">second value</param>
+    /// <param name="epsilon">presision</param>
+    /// <returns>true if values are equal else false</returns>
+    static bool equalValues(T a, T b, double epsilon) {
+        if constexpr (std::is_integral_v<T>) {
+            return a == b;
+        } else {
+            double max = std::max({ 1.0, std::fabs(double(a)) , std::fabs(double(b)) });
+            return std::fabs(double(a) - double(b)) <= epsilon * max;
+        }
+    }
+
+    /// <summary>
+    /// Dot product, exact for integer coords
+    /// </summary>
+    /// <param name="p">second vector</param>
+    /// <returns>x * p.x + y * p.y</returns>
+    T dot(const Point2& p) const {
+        return x * p.x + y * p.y;
+    }
+
+    /// <summary>
+    /// Cross product, exact for integer coords
+    /// </summary>
+    /// <param name="p">second vector</param>
+    /// <returns>x * p.y - y * p.x</returns>
+    T cross(const Point2& p) const {
+        return x * p.y - y * p.x;
     }
 
     /// <summary>
@@ -101,10 +142,10 @@ struct Point2 {
     /// </summary>
     /// <returns>return normalized point</returns>
     Point2 getNormalized() const {
-        T norm { sqrt(x * x + y * y) };
+        T norm { std::sqrt(x * x + y * y) };
         
         if(norm == 0) {
-            throw std::exception("division by 0");
+            throw std::runtime_error("division by 0");
         }
         
         return Point2(x / norm, y / norm);
@@ -0,0 +1,222 @@
+#pragma once
+
+#include "Point2.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Uniform grid over nodes that finds node equal to point like Point2::isEqual.
+/// Nodes of polygon lie along curve, so size of cell is mean edge length (perimeter / N) or
+/// mean spacing of nodes spread over bounding box (extent / sqrt(N)), whichever is smaller,
+/// and not less than max tolerance, so expected count of scanned cells and nodes per query is O(1).
+/// Most cells of such grid are empty, so only cells with nodes are stored in hash table of O(N) buckets.
+/// Tolerance is relative: |a - b| <= epsilon * max(1, |a|, |b|), so query scans all cells
+/// that intersect window |x - p.x| <= epsilon * max(1, |p.x|) / (1 - epsilon).
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class PointIndex {
+    public:
+        static constexpr size_t npos { static_cast<size_t>(-1) };
+
+        /// <summary>
+        /// base constructor
+        /// </summary>
+        PointIndex() {}
+
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="nodes">indexed nodes</param>
+        /// <param name="epsilon">presision</param>
+        template <class Nodes>
+        PointIndex(const Nodes& nodes, double epsilon) {
+            build(nodes, epsilon);
+        }
+
+        /// <summary>
+        /// Build grid over nodes in O(N)
+        /// </summary>
+        /// <param name="nodes">indexed nodes</param>
+        /// <param name="epsilon">presision</param>
+        /// <remarks>memory of previous build is reused</remarks>
+        template <class Nodes>
+        void build(const Nodes& nodes, double epsilon) {
+            auto size { nodes.size() };
+            m_epsilon = epsilon;
+            m_nodes.resize(size);
+            for (size_t i{}; i < size; ++i) {
+                m_nodes[i] = nodes[i];
+            }
+
+            m_min = size == 0 ? Point2<T>{} : m_nodes.front();
+            Point2<T> max { m_min };
+            for (const auto& node : m_nodes) {
+                m_min.x = std::min(m_min.x, node.x);
+                m_min.y = std::min(m_min.y, node.y);
+                max.x = std::max(max.x, node.x);
+                max.y = std::max(max.y, node.y);
+            }
+
+            double extent { std::max<double>(max.x - m_min.x, max.y - m_min.y) },
+                   scale { std::max({ 1.0, std::fabs(double(m_min.x)), std::fabs(double(m_min.y)),
+                                      std::fabs(double(max.x)), std::fabs(double(max.y)) }) };
+            double perimeter{};
+            for (size_t i{}; i < size; ++i) {
+                const auto& a { m_nodes[i] };
+                const auto& b { m_nodes[i + 1 < size ? i + 1 : 0] };
+                perimeter += std::hypot(double(b.x) - double(a.x), double(b.y) - double(a.y));
+            }
+            double count { std::max<double>(double(size), 1.0) };
+            m_cellSize = std::max(std::min(extent / std::sqrt(count), perimeter / count), getWidth(scale));
+            if (!(m_cellSize > 0) || !std::isfinite(m_cellSize)) {
+                m_cellSize = std::max(extent, 1.0);
+            }
+            m_columns = static_cast<size_t>((max.x - m_min.x) / m_cellSize) + 1;
+            m_rows = static_cast<size_t>((max.y - m_min.y) / m_cellSize) + 1;
+            m_mask = 1;
+            while (m_mask < 2 * size) {
+                m_mask <<= 1;
+            }
+            --m_mask;
+
+            // counting sort of nodes by buckets of cells
+            m_cellStart.assign(m_mask + 2, 0);
+            for (const auto& node : m_nodes) {
+                ++m_cellStart[getBucket(getColumn(node.x), getRow(node.y)) + 1];
+            }
+            for (size_t i{ 1 }; i < m_cellStart.size(); ++i) {
+                m_cellStart[i] += m_cellStart[i - 1];
+            }
+            m_indices.resize(size);
+            m_next.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+            for (size_t i{}; i < size; ++i) {
+                m_indices[m_next[getBucket(getColumn(m_nodes[i].x), getRow(m_nodes[i].y))]++] = i;
+            }
+        }
+
+        /// <summary>
+        /// Get count of indexed nodes
+        /// </summary>
+        /// <returns>count of nodes</returns>
+        size_t size() const {
+            return m_nodes.size();
+        }
+
+        /// <summary>
+        /// Get size of buffers of index
+        /// </summary>
+        /// <returns>count of bytes</returns>
+        size_t getMemorySize() const {
+            return m_nodes.capacity() * sizeof(Point2<T>) +
+                   (m_cellStart.capacity() + m_indices.capacity() + m_next.capacity()) * sizeof(size_t);
+        }
+
+        /// <summary>
+        /// Find node that is equal to point with presision of index
+        /// </summary>
+        /// <param name="p">point</param>
+        /// <returns>smallest index of equal node or npos if it is not found</returns>
+        size_t find(const Point2<T>& p) const {
+            size_t result { npos };
+            scan(p, [&](size_t i) {
+                if (i < result && p.isEqual(m_nodes[i], m_epsilon)) {
+                    result = i;
+                }
+            });
+            return result;
+        }
+
+        /// <summary>
+        /// Get count of nodes that are compared with point by find
+        /// </summary>
+        /// <param name="p">point</param>
+        /// <returns>count of scanned nodes</returns>
+        size_t getScanCount(const Point2<T>& p) const {
+            size_t count{};
+            scan(p, [&](size_t) { ++count; });
+            return count;
+        }
+
+        /// <summary>
+        /// Check that some node is equal to point
+        /// </summary>
+        /// <param name="p">point</param>
+        /// <returns>true if equal node exists else false</returns>
+        bool contains(const Point2<T>& p) const {
+            return find(p) != npos;
+        }
+    private:
+        /// <summary>
+        /// Visit nodes of all cells that intersect window of tolerance around point.
+        /// Nodes of other cells with the same bucket are visited too, visitor compares them
+        /// </summary>
+        template <class Visit>
+        void scan(const Point2<T>& p, Visit visit) const {
+            double wx { getWidth(std::max(1.0, std::fabs(double(p.x)))) },
+                   wy { getWidth(std::max(1.0, std::fabs(double(p.y)))) };
+            double left { (p.x - wx - m_min.x) / m_cellSize }, right { (p.x + wx - m_min.x) / m_cellSize },
+                   bottom { (p.y - wy - m_min.y) / m_cellSize }, top { (p.y + wy - m_min.y) / m_cellSize };
+
+            if (m_nodes.empty() || !(right >= 0) || !(top >= 0) || left >= m_columns || bottom >= m_rows) {
+                return;
+            }
+
+            size_t firstColumn { left > 0 ? static_cast<size_t>(left) : 0 },
+                   lastColumn { right < m_columns ? static_cast<size_t>(right) : m_columns - 1 },
+                   firstRow { bottom > 0 ? static_cast<size_t>(bottom) : 0 },
+                   lastRow { top < m_rows ? static_cast<size_t>(top) : m_rows - 1 };
+
+            // window is wider than grid: scan nodes directly
+            if ((lastColumn - firstColumn + 1) * (lastRow - firstRow + 1) > m_nodes.size()) {
+                for (size_t i{}; i < m_nodes.size(); ++i) {
+                    visit(i);
+                }
+                return;
+            }
+
+            for (size_t column{ firstColumn }; column <= lastColumn; ++column) {
+                for (size_t row{ firstRow }; row <= lastRow; ++row) {
+                    size_t bucket { getBucket(column, row) };
+                    for (size_t k{ m_cellStart[bucket] }; k < m_cellStart[bucket + 1]; ++k) {
+                        visit(m_indices[k]);
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Get max difference of coords that can be equal
+        /// </summary>
+        /// <param name="scale">max(1, |coord|)</param>
+        /// <returns>half width of window</returns>
+        double getWidth(double scale) const {
+            return m_epsilon < 1 ? m_epsilon * scale / (1 - m_epsilon) : HUGE_VAL;
+        }
+
+        size_t getColumn(T x) const {
+            return std::min(m_columns - 1, static_cast<size_t>((x - m_min.x) / m_cellSize));
+        }
+
+        size_t getRow(T y) const {
+            return std::min(m_rows - 1, static_cast<size_t>((y - m_min.y) / m_cellSize));
+        }
+
+        size_t getBucket(size_t column, size_t row) const {
+            uint64_t hash { uint64_t(column) * 0x9E3779B97F4A7C15ull ^ uint64_t(row) * 0xC2B2AE3D27D4EB4Full };
+            return static_cast<size_t>(hash ^ (hash >> 29)) & m_mask;
+        }
+
+        double m_epsilon{};
+        double m_cellSize{ 1 };
+        size_t m_columns{ 1 }, m_rows{ 1 };
+        size_t m_mask{};
+        Point2<T> m_min{};
+        std::vector<Point2<T>> m_nodes;
+        std::vector<size_t> m_cellStart;
+        std::vector<size_t> m_indices;
+        std::vector<size_t> m_next;
+};
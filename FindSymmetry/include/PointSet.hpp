@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Point2.hpp"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// Unordered set of points, for example sensor hits or drill holes.
+/// Unlike Polygon order of points has no meaning, so set has no edges and no orientation.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class PointSet {
+    public:
+        /// <summary>
+        /// base constructor
+        /// </summary>
+        PointSet() {}
+
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="points">points of set in any order</param>
+        PointSet(const std::vector<Point2<T>>& points) : m_points(points) {}
+
+        /// <summary>
+        /// Init constructor that takes points without copy
+        /// </summary>
+        /// <param name="points">points of set in any order</param>
+        PointSet(std::vector<Point2<T>>&& points) : m_points(std::move(points)) {}
+
+        /// <summary>
+        /// Get all points of set
+        /// </summary>
+        /// <returns>readonly points</returns>
+        const std::vector<Point2<T>>& getPoints() const {
+            return m_points;
+        }
+
+        /// <summary>
+        /// Get count of points
+        /// </summary>
+        /// <returns>count of points</returns>
+        size_t size() const {
+            return m_points.size();
+        }
+
+        /// <summary>
+        /// Add point into set
+        /// </summary>
+        /// <param name="p">added point</param>
+        void insert(const Point2<T>& p) {
+            m_points.push_back(p);
+        }
+
+        /// <summary>
+        /// Get centroid of points, every axis of symmetry passes through it
+        /// </summary>
+        /// <returns>mean of points</returns>
+        Point2<RealOf<T>> getCentroid() const {
+            using Real = RealOf<T>;
+            Point2<Real> centroid{};
+            for (const auto& p : m_points) {
+                centroid += Point2<Real>(Real(p.x), Real(p.y));
+            }
+            if (!m_points.empty()) {
+                centroid /= static_cast<double>(m_points.size());
+            }
+            return centroid;
+        }
+    private:
+        std::vector<Point2<T>> m_points;
+};
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "Point2.hpp"
+#include "Axis.hpp"
+#include "PointSet.hpp"
+#include "CyclicMatcher.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <vector>
+
+/// <summary>
+/// Axes of symmetry of unordered point set in O(N log N).
+/// Every axis passes through centroid and reflection keeps distance to centroid, so set is
+/// split into shells of equal radius and every shell must be symmetric itself.
+/// Points of shell are sorted by angle, reflection across line with angle phi maps angle a to
+/// 2 phi - a and reverses cyclic sequence of angular gaps, so axes of shell are cyclic shifts
+/// of reversed gaps that are equal to gaps, they are found by KMP like in Linear engine.
+/// Axes of set are angles that are axes of every shell. Points in centroid lie on any axis.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class PointSetSymmetry {
+    public:
+        /// <summary>
+        /// Find axes of symmetry of point set
+        /// </summary>
+        /// <param name="set">unordered points</param>
+        /// <param name="epsilon">presision of coords like in Point2::isEqual</param>
+        /// <returns>axes through centroid, ends of axis are at max distance of points from centroid.
+        /// Set whose points are all in centroid (empty set, one point, copies of one point) is symmetric
+        /// about every line through centroid, it has no finite list of axes and empty vector is returned
+        /// like for non-symmetric set, check set for that case before if it matters</returns>
+        std::vector<Axis<RealOf<T>>> findSymmetry(const PointSet<T>& set, double epsilon) const {
+            using Real = RealOf<T>;
+            std::vector<Axis<Real>> axes{};
+            auto centroid { set.getCentroid() };
+
+            // polar coords around centroid
+            std::vector<Polar> polar{};
+            polar.reserve(set.size());
+            double maxRadius{};
+            for (const auto& p : set.getPoints()) {
+                double x { double(p.x) - double(centroid.x) }, y { double(p.y) - double(centroid.y) };
+                polar.push_back(Polar{ std::hypot(x, y), std::atan2(y, x) });
+                maxRadius = std::max(maxRadius, polar.back().radius);
+            }
+            double centerTolerance { epsilon * std::max(1.0, maxRadius) };
+            std::erase_if(polar, [&](const Polar& point) { return point.radius <= centerTolerance; });
+            if (polar.empty()) {
+                // every line through centroid is axis, it is not listed (see returns)
+                return axes;
+            }
+            std::sort(polar.begin(), polar.end(), [](const Polar& a, const Polar& b) { return a.radius < b.radius; });
+
+            std::vector<double> candidates{}, shellAxes{};
+            double candidateTolerance{};
+            for (size_t begin{}, end{}; begin < polar.size(); begin = end) {
+                end = begin + 1;
+                while (end < polar.size() && polar[end].radius - polar[end - 1].radius <= epsilon * std::max(1.0, polar[end].radius)) {
+                    ++end;
+                }
+
+                double radius { polar[begin].radius };
+                double tolerance { std::max(2 * epsilon * std::max(1.0, radius) / radius, 1e-12) };
+                findShellAxes(polar, begin, end, tolerance, shellAxes);
+                if (begin == 0) {
+                    candidates = shellAxes;
+                    candidateTolerance = tolerance;
+                } else {
+                    std::erase_if(candidates, [&](double angle) {
+                        return !containsAngle(shellAxes, angle, candidateTolerance + tolerance);
+                    });
+                }
+                if (candidates.empty()) {
+                    return axes;
+                }
+            }
+
+            for (double angle : candidates) {
+                Point2<Real> direction { Real(maxRadius * std::cos(angle)), Real(maxRadius * std::sin(angle)) };
+                axes.push_back(Axis<Real>(centroid - direction, centroid + direction));
+            }
+            return axes;
+        }
+    private:
+        struct Polar {
+            double radius;
+            double angle;
+        };
+
+        /// <summary>
+        /// Find angles of axes of one shell in [0, pi), sorted and without duplicates
+        /// </summary>
+        /// <param name="polar">points sorted by radius</param>
+        /// <param name="begin">first point of shell</param>
+        /// <param name="end">point after last point of shell</param>
+        /// <param name="tolerance">presision of angles</param>
+        /// <param name="axes">output: angles of axes</param>
+        static void findShellAxes(const std::vector<Polar>& polar, size_t begin, size_t end, double tolerance, std::vector<double>& axes) {
+            auto size { end - begin };
+            std::vector<double> angles(size), gaps(size), reversed(size);
+            for (size_t i{}; i < size; ++i) {
+                angles[i] = polar[begin + i].angle;
+            }
+            std::sort(angles.begin(), angles.end());
+            for (size_t i{}; i < size; ++i) {
+                gaps[i] = i + 1 < size ? angles[i + 1] - angles[i] : angles[0] + 2 * std::numbers::pi - angles[i];
+            }
+            for (size_t q{}; q < size; ++q) {
+                reversed[q] = gaps[size - 1 - q];
+            }
+
+            // gap j of reflection that maps point j to point k - j is gap k - 1 - j,
+            // so shift s of reversed gaps pairs point 0 with point k = -s mod size
+            auto equal = [tolerance](double a, double b) { return std::fabs(a - b) <= tolerance; };
+            auto shifts { findCyclicShifts(gaps, reversed, equal) };
+            axes.clear();
+            for (auto shift : shifts) {
+                double angle { std::fmod((angles[0] + angles[(size - shift) % size]) / 2, std::numbers::pi) };
+                axes.push_back(angle < 0 ? angle + std::numbers::pi : angle);
+            }
+            std::sort(axes.begin(), axes.end());
+
+            // equal points give the same axis several times, axis near 0 is the same as axis near pi
+            axes.erase(std::unique(axes.begin(), axes.end(), [&](double a, double b) { return b - a <= tolerance; }), axes.end());
+            if (axes.size() > 1 && axes.front() + std::numbers::pi - axes.back() <= tolerance) {
+                axes.pop_back();
+            }
+        }
+
+        /// <summary>
+        /// Check that sorted angles of axes contain angle, angles are compared modulo pi
+        /// </summary>
+        static bool containsAngle(const std::vector<double>& axes, double angle, double tolerance) {
+            if (axes.empty()) {
+                return false;
+            }
+            auto distance = [&](double other) {
+                double d { std::fabs(other - angle) };
+                return std::min(d, std::numbers::pi - d);
+            };
+            auto next { std::lower_bound(axes.begin(), axes.end(), angle) };
+            auto prev { next == axes.begin() ? axes.end() - 1 : next - 1 };
+            if (next == axes.end()) {
+                next = axes.begin();
+            }
+            return distance(*next) <= tolerance || distance(*prev) <= tolerance;
+        }
+};
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Point2.hpp"
+#include "PointIndex.hpp"
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 /// <summary>
@@ -22,6 +25,25 @@ class Polygon {
         /// <param name="nodes"></param>
         Polygon(const std::vector<Point2<T>>& nodes) : m_nodes(nodes) {}
 
+        /// <summary>
+        /// Init constructor that takes nodes without copy
+        /// </summary>
+        /// <param name="nodes"></param>
+        Polygon(std::vector<Point2<T>>&& nodes) : m_nodes(std::move(nodes)) {}
+
+        /// <summary>
+        /// Copy nodes into polygon, memory of polygon is reused
+        /// </summary>
+        /// <param name="nodes">nodes of polygon</param>
+        template <class Nodes>
+        void assign(const Nodes& nodes) {
+            auto size { nodes.size() };
+            m_nodes.resize(size);
+            for (size_t i{}; i < size; ++i) {
+                m_nodes[i] = nodes[i];
+            }
+        }
+
         /// <summary>
         /// Get center of polygon
         /// </summary>
@@ -61,11 +83,12 @@ class Polygon {
         /// <param name="angle">rotated angle</param>
         /// <param name="axis">rotated axis</param>
         void rotate(T angle, Point2<T>& axis) {
+            T c { std::cos(angle) }, k { 1 - c };
+            T xx { c + k * axis.x * axis.x }, xy { k * axis.x * axis.y }, yy { c + k * axis.y * axis.y };
+
             for(auto& node : m_nodes) {
-                T nx { node.x * (cos(angle) + (1 - cos(angle)) * pow(axis.x, 2)) + 
-                            node.y * ((1 - cos(angle)) * axis.x * axis.y) },
-                  ny{ node.x * ((1 - cos(angle)) * axis.x * axis.y) + 
-                            node.y * (cos(angle) + (1 - cos(angle)) * pow(axis.y, 2)) };
+                T nx { node.x * xx + node.y * xy },
+                  ny { node.x * xy + node.y * yy };
                 node.x = nx;
                 node.y = ny;
             }
@@ -78,28 +101,96 @@ class Polygon {
         /// <param name="p">polygon for compare</param>
         /// <param name="epsilon">presision</param>
         /// <returns>true if this polygon is equal p else false</returns>
-        bool isEqual(Polygon& p, double epsilon) {
+        bool isEqual(const Polygon& p, double epsilon) const {
 
             if (p.getNodes().size() != m_nodes.size()) {
                 return false;
             }
-            std::vector<Point2<T>> nodes1(m_nodes);
-            std::vector<Point2<T>> nodes2(p.getNodes());
             int startIndex {-1};
 
             //try find shifted 0 - index
-            for(int i{}; i < nodes2.size(); ++i) {
-                if(nodes1.front().isEqual(nodes2[i], epsilon)) {
+            for(int i{}; i < p.getNodes().size(); ++i) {
+                if(m_nodes.front().isEqual(p.getNodes()[i], epsilon)) {
                     startIndex = i;
                     break;
                 }
             }
 
+            return isEqualFrom(p, startIndex, epsilon);
+        }
+
+        /// <summary>
+        /// Compare 2 polygons like isEqual, shifted 0 - index is found by index
+        /// over nodes of p in expected O(1)
+        /// </summary>
+        /// <param name="p">polygon for compare</param>
+        /// <param name="epsilon">presision</param>
+        /// <param name="index">index over nodes of p</param>
+        /// <returns>true if this polygon is equal p else false</returns>
+        bool isEqual(const Polygon& p, double epsilon, const PointIndex<T>& index) const {
+
+            if (p.getNodes().size() != m_nodes.size() || index.size() != m_nodes.size()) {
+                return false;
+            }
+            if (m_nodes.empty()) {
+                return true;
+            }
+
+            auto found { index.find(m_nodes.front()) };
+            return isEqualFrom(p, found == PointIndex<T>::npos ? -1 : static_cast<int>(found), epsilon);
+        }
+
+        /// <summary>
+        /// Move node of polygon
+        /// </summary>
+        /// <param name="index">index of node</param>
+        /// <param name="p">new position of node</param>
+        void setNode(size_t index, const Point2<T>& p) {
+            if (index >= m_nodes.size()) {
+                throw std::runtime_error("Index of node is out of range");
+            }
+            m_nodes[index] = p;
+        }
+
+        /// <summary>
+        /// Insert node before node with index, index equal to count of nodes appends node
+        /// </summary>
+        /// <param name="index">index of inserted node</param>
+        /// <param name="p">inserted node</param>
+        void insertNode(size_t index, const Point2<T>& p) {
+            if (index > m_nodes.size()) {
+                throw std::runtime_error("Index of node is out of range");
+            }
+            m_nodes.insert(m_nodes.begin() + index, p);
+        }
+
+        /// <summary>
+        /// Erase node of polygon
+        /// </summary>
+        /// <param name="index">index of erased node</param>
+        void eraseNode(size_t index) {
+            if (index >= m_nodes.size()) {
+                throw std::runtime_error("Index of node is out of range");
+            }
+            m_nodes.erase(m_nodes.begin() + index);
+        }
+    private:
+        /// <summary>
+        /// Compare nodes of polygons when node 0 of this polygon is equal to node startIndex of p
+        /// </summary>
+        /// <param name="p">polygon for compare</param>
+        /// <param name="startIndex">shifted 0 - index or -1 if it is not found</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>true if this polygon is equal p else false</returns>
+        bool isEqualFrom(const Polygon& p, int startIndex, double epsilon) const {
             //If not found return false
             if(startIndex == -1) {
                 return false;
             }
 
+            const auto& nodes1 { m_nodes };
+            const auto& nodes2 { p.getNodes() };
+
             // try to get rotation clockwise or counterclockwise
             bool isLeftRotation{};
             int newIndex {startIndex + 1 < nodes1.size() ? startIndex + 1 : 0};
@@ -130,6 +221,6 @@ class Polygon {
 
             return true;
         }
-    private:
+
         std::vector<Point2<T>> m_nodes;
 };
\ No newline at end of file
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "Polygon.hpp"
+#include "PolygonView.hpp"
+#include "PolygonReader.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Header of binary polygon file. File layout:
+/// header (32 bytes), offset table of polygonCount + 1 uint64 (polygon i has nodes
+/// [offsets[i], offsets[i + 1])), x column of nodeCount float64, y column of nodeCount float64.
+/// All values are stored in byte order of writer, it is checked by byteOrder field.
+/// </summary>
+struct PolygonFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t polygonCount;
+    uint64_t nodeCount;
+
+    static constexpr char kMagic[8] { 'P', 'S', 'Y', 'M', 'B', 'I', 'N', '\0' };
+    static constexpr uint32_t kVersion { 1 };
+    static constexpr uint32_t kByteOrder { 0x01020304 };
+};
+
+static_assert(sizeof(PolygonFileHeader) == 32, "header of polygon file must be 32 bytes");
+
+/// <summary>
+/// Write polygons into binary file
+/// </summary>
+/// <param name="filename">string that contains directory for file</param>
+/// <param name="polygons">written polygons</param>
+inline void writePolygonFile(const std::string& filename, const std::vector<Polygon<double>>& polygons) {
+    PolygonFileHeader header{};
+    std::memcpy(header.magic, PolygonFileHeader::kMagic, sizeof(header.magic));
+    header.version = PolygonFileHeader::kVersion;
+    header.byteOrder = PolygonFileHeader::kByteOrder;
+    header.polygonCount = polygons.size();
+
+    std::vector<uint64_t> offsets{ 0 };
+    for (const auto& polygon : polygons) {
+        offsets.push_back(offsets.back() + polygon.getNodes().size());
+    }
+    header.nodeCount = offsets.back();
+
+    std::vector<double> column(header.nodeCount);
+    std::ofstream out(filename, std::ios::binary);
+    if (!out.is_open()) {
+        throw std::runtime_error("File can not be created");
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(uint64_t));
+
+    for (int coord{}; coord < 2; ++coord) {
+        size_t k{};
+        for (const auto& polygon : polygons) {
+            for (const auto& node : polygon.getNodes()) {
+                column[k++] = coord == 0 ? node.x : node.y;
+            }
+        }
+        out.write(reinterpret_cast<const char*>(column.data()), column.size() * sizeof(double));
+    }
+
+    if (!out) {
+        throw std::runtime_error("File can not be written");
+    }
+}
+
+/// <summary>
+/// Convert text file with polygons into binary file
+/// </summary>
+/// <param name="input">text file</param>
+/// <param name="output">binary file</param>
+/// <returns>count of converted polygons</returns>
+inline size_t convertPolygonFile(const std::string& input, const std::string& output) {
+    auto polygons { readPolygons<double>(input) };
+    writePolygonFile(output, polygons);
+    return polygons.size();
+}
+
+/// <summary>
+/// Binary polygon file mapped into memory. Polygons are exposed as views
+/// into mapped columns without copy, polygon i is found by offset table in O(1).
+/// </summary>
+class PolygonFile {
+    public:
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="filename">string that contains directory for file</param>
+        explicit PolygonFile(const std::string& filename) : m_file(filename) {
+            if (!isPolygonFile(m_file.data(), m_file.size())) {
+                throw std::runtime_error("File is not binary polygon file");
+            }
+            std::memcpy(&m_header, m_file.data(), sizeof(m_header));
+            if (m_header.version != PolygonFileHeader::kVersion) {
+                throw std::runtime_error("Unsupported version of polygon file");
+            }
+            if (m_header.byteOrder != PolygonFileHeader::kByteOrder) {
+                throw std::runtime_error("Polygon file has another byte order");
+            }
+
+            uint64_t expected { sizeof(PolygonFileHeader) + (m_header.polygonCount + 1) * sizeof(uint64_t) +
+                                2 * m_header.nodeCount * sizeof(double) };
+            if (m_header.polygonCount >= m_file.size() || m_header.nodeCount >= m_file.size() || expected != m_file.size()) {
+                throw std::runtime_error("Polygon file is truncated");
+            }
+
+            const char* data { m_file.data() + sizeof(PolygonFileHeader) };
+            m_offsets = reinterpret_cast<const uint64_t*>(data);
+            m_x = reinterpret_cast<const double*>(data + (m_header.polygonCount + 1) * sizeof(uint64_t));
+            m_y = m_x + m_header.nodeCount;
+        }
+
+        /// <summary>
+        /// Get count of polygons
+        /// </summary>
+        /// <returns>count of polygons</returns>
+        size_t size() const {
+            return static_cast<size_t>(m_header.polygonCount);
+        }
+
+        /// <summary>
+        /// Get polygon by index without copy
+        /// </summary>
+        /// <param name="i">index of polygon</param>
+        /// <returns>view into mapped file, it is valid while file is alive</returns>
+        PolygonView<double> operator[](size_t i) const {
+            uint64_t begin { m_offsets[i] }, end { m_offsets[i + 1] };
+            if (begin > end || end > m_header.nodeCount) {
+                throw std::runtime_error("Invalid offset table of polygon file");
+            }
+            return PolygonView<double>(m_x + begin, m_y + begin, static_cast<size_t>(end - begin));
+        }
+
+        /// <summary>
+        /// Get views of all polygons
+        /// </summary>
+        /// <returns>views into mapped file</returns>
+        std::vector<PolygonView<double>> getViews() const {
+            std::vector<PolygonView<double>> views{};
+            views.reserve(size());
+            for (size_t i{}; i < size(); ++i) {
+                views.push_back((*this)[i]);
+            }
+            return views;
+        }
+
+        /// <summary>
+        /// Check that data starts with header of binary polygon file
+        /// </summary>
+        /// <param name="data">content of file</param>
+        /// <param name="size">size of content</param>
+        /// <returns>true if magic is found else false</returns>
+        static bool isPolygonFile(const char* data, size_t size) {
+            return size >= sizeof(PolygonFileHeader) &&
+                   std::memcmp(data, PolygonFileHeader::kMagic, sizeof(PolygonFileHeader::kMagic)) == 0;
+        }
+
+        /// <summary>
+        /// Check that file is binary polygon file
+        /// </summary>
+        /// <param name="filename">string that contains directory for file</param>
+        /// <returns>true if magic is found else false</returns>
+        static bool isPolygonFile(const std::string& filename) {
+            MappedFile file { filename };
+            return isPolygonFile(file.data(), file.size());
+        }
+    private:
+        MappedFile m_file;
+        PolygonFileHeader m_header{};
+        const uint64_t* m_offsets{};
+        const double* m_x{};
+        const double* m_y{};
+};
@@ -0,0 +1,241 @@
+#pragma once
+
+#include "Polygon.hpp"
+#include <charconv>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/// <summary>
+/// Readonly file mapped into memory
+/// </summary>
+class MappedFile {
+    public:
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="filename">string that contains directory for file</param>
+        explicit MappedFile(const std::string& filename) {
+#ifdef _WIN32
+            m_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (m_file == INVALID_HANDLE_VALUE) {
+                throw std::runtime_error("File not found");
+            }
+            LARGE_INTEGER size{};
+            GetFileSizeEx(m_file, &size);
+            m_size = static_cast<size_t>(size.QuadPart);
+            if (m_size > 0) {
+                m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                m_data = m_mapping != nullptr ? static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+                if (m_data == nullptr) {
+                    close();
+                    throw std::runtime_error("File can not be mapped");
+                }
+            }
+#else
+            m_file = ::open(filename.c_str(), O_RDONLY);
+            if (m_file < 0) {
+                throw std::runtime_error("File not found");
+            }
+            struct stat info{};
+            ::fstat(m_file, &info);
+            m_size = static_cast<size_t>(info.st_size);
+            if (m_size > 0) {
+                void* data { ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_file, 0) };
+                if (data == MAP_FAILED) {
+                    close();
+                    throw std::runtime_error("File can not be mapped");
+                }
+                m_data = static_cast<const char*>(data);
+                ::madvise(data, m_size, MADV_SEQUENTIAL);
+            }
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile() {
+            close();
+        }
+
+        /// <summary>
+        /// Get content of file
+        /// </summary>
+        /// <returns>pointer to first byte</returns>
+        const char* data() const {
+            return m_data;
+        }
+
+        /// <summary>
+        /// Get size of file
+        /// </summary>
+        /// <returns>count of bytes</returns>
+        size_t size() const {
+            return m_size;
+        }
+    private:
+        void close() {
+#ifdef _WIN32
+            if (m_data != nullptr) {
+                UnmapViewOfFile(m_data);
+            }
+            if (m_mapping != nullptr) {
+                CloseHandle(m_mapping);
+            }
+            if (m_file != INVALID_HANDLE_VALUE) {
+                CloseHandle(m_file);
+            }
+            m_mapping = nullptr;
+            m_file = INVALID_HANDLE_VALUE;
+#else
+            if (m_data != nullptr) {
+                ::munmap(const_cast<char*>(m_data), m_size);
+            }
+            if (m_file >= 0) {
+                ::close(m_file);
+            }
+            m_file = -1;
+#endif
+            m_data = nullptr;
+        }
+
+#ifdef _WIN32
+        HANDLE m_file{ INVALID_HANDLE_VALUE };
+        HANDLE m_mapping{};
+#else
+        int m_file{ -1 };
+#endif
+        const char* m_data{};
+        size_t m_size{};
+};
+
+/// <summary>
+/// Parse polygons from text: every polygon is a list of numbers "x y".
+/// Polygons are separated by blank lines or by header lines that start with '#'.
+/// First pass counts numbers of every polygon, so nodes are allocated once,
+/// second pass parses numbers by std::from_chars.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+/// <param name="begin">first char of text</param>
+/// <param name="end">char after last char of text</param>
+/// <returns>polygons in order of text</returns>
+template <typename T>
+std::vector<Polygon<T>> parsePolygons(const char* begin, const char* end) {
+    struct Record {
+        const char* begin;
+        const char* end;
+        size_t count;
+    };
+
+    auto isSpace = [](char c) { return c == ' ' || c == '\t' || c == '\r' || c == ','; };
+
+    // first pass: split text into records and count numbers
+    std::vector<Record> records{};
+    Record record { nullptr, nullptr, 0 };
+    for (const char* line { begin }; line < end;) {
+        const char* lineEnd { line };
+        while (lineEnd < end && *lineEnd != '\n') {
+            ++lineEnd;
+        }
+
+        const char* c { line };
+        while (c < lineEnd && isSpace(*c)) {
+            ++c;
+        }
+        if (c == lineEnd || *c == '#') {
+            if (record.count > 0) {
+                records.push_back(record);
+            }
+            record = Record{ nullptr, nullptr, 0 };
+        } else {
+            if (record.begin == nullptr) {
+                record.begin = line;
+            }
+            record.end = lineEnd;
+            for (bool inNumber{}; c < lineEnd; ++c) {
+                if (!isSpace(*c) && !inNumber) {
+                    ++record.count;
+                }
+                inNumber = !isSpace(*c);
+            }
+        }
+        line = lineEnd + 1;
+    }
+    if (record.count > 0) {
+        records.push_back(record);
+    }
+
+    // second pass: parse numbers
+    std::vector<Polygon<T>> polygons{};
+    polygons.reserve(records.size());
+    for (const auto& r : records) {
+        if (r.count % 2 != 0) {
+            throw std::runtime_error("Polygon has odd count of coords");
+        }
+
+        std::vector<Point2<T>> nodes(r.count / 2);
+        const char* c { r.begin };
+        for (size_t i{}; i < r.count; ++i) {
+            while (isSpace(*c) || *c == '\n') {
+                ++c;
+            }
+            T value{};
+            auto parsed { std::from_chars(c + (*c == '+' ? 1 : 0), r.end, value) };
+            if (parsed.ec != std::errc{} || (parsed.ptr != r.end && !isSpace(*parsed.ptr) && *parsed.ptr != '\n')) {
+                throw std::runtime_error("Invalid number in file");
+            }
+            c = parsed.ptr;
+            if (i % 2 == 0) {
+                nodes[i / 2].x = value;
+            } else {
+                nodes[i / 2].y = value;
+            }
+        }
+        polygons.push_back(Polygon<T>{ std::move(nodes) });
+    }
+
+    return polygons;
+}
+
+/// <summary>
+/// Read all polygons from memory mapped file
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+/// <param name="filename">string that contains directory for file</param>
+/// <returns>polygons in order of file</returns>
+template <typename T>
+std::vector<Polygon<T>> readPolygons(const std::string& filename) {
+    MappedFile file { filename };
+    return parsePolygons<T>(file.data(), file.data() + file.size());
+}
+
+/// <summary>
+/// Read polygon from file
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+/// <param name="filename">string that contains directory for file</param>
+/// <returns>first polygon of file</returns>
+template <typename T>
+Polygon<T> readPolygon(const std::string& filename) {
+    auto polygons { readPolygons<T>(filename) };
+    if (polygons.empty()) {
+        throw std::runtime_error("File has no polygon");
+    }
+    return polygons.front();
+}
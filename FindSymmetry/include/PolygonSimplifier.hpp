@@ -0,0 +1,192 @@
+#pragma once
+
+#include "Point2.hpp"
+#include "PolygonView.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/// <summary>
+/// Normalization of polygon before detection in O(N): consecutive equal nodes are merged and
+/// nodes that lie on straight run of edges are removed. Collinear nodes inflate N and can hide
+/// symmetry, for example side of square split by one extra node. Node is collinear when it goes
+/// forward and sine of its turn is not greater than epsilon, so smooth curves with small turns
+/// are kept. Kept nodes remember their indices in original polygon, so elements of simplified
+/// polygon are mapped back to original vertices and middles of original edges (mapPosition).
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class PolygonSimplifier {
+    public:
+        /// <summary>
+        /// Simplify polygon, memory of previous call is reused
+        /// </summary>
+        /// <param name="nodes">nodes of polygon</param>
+        /// <param name="epsilon">presision, integer coords are compared exactly</param>
+        template <class Nodes>
+        void simplify(const Nodes& nodes, double epsilon) {
+            auto size { nodes.size() };
+            m_nodes.clear();
+            m_indices.clear();
+
+            for (size_t i{}; i < size; ++i) {
+                Point2<T> node { nodes[i] };
+                checkRange(node);
+                if (!m_nodes.empty() && node.isEqual(m_nodes.back(), epsilon)) {
+                    continue;
+                }
+                while (m_nodes.size() >= 2 && isCollinear(m_nodes[m_nodes.size() - 2], m_nodes.back(), node, epsilon)) {
+                    m_nodes.pop_back();
+                    m_indices.pop_back();
+                }
+                m_nodes.push_back(node);
+                m_indices.push_back(i);
+            }
+
+            // close the ring: last and first nodes are neighbours too, removed first nodes are skipped by begin
+            size_t begin{};
+            for (bool changed { true }; changed && m_nodes.size() - begin >= 3;) {
+                changed = false;
+                if (m_nodes.back().isEqual(m_nodes[begin], epsilon) ||
+                    isCollinear(m_nodes[m_nodes.size() - 2], m_nodes.back(), m_nodes[begin], epsilon)) {
+                    m_nodes.pop_back();
+                    m_indices.pop_back();
+                    changed = true;
+                } else if (isCollinear(m_nodes.back(), m_nodes[begin], m_nodes[begin + 1], epsilon)) {
+                    ++begin;
+                    changed = true;
+                }
+            }
+            m_nodes.erase(m_nodes.begin(), m_nodes.begin() + begin);
+            m_indices.erase(m_indices.begin(), m_indices.begin() + begin);
+
+            // degenerate polygon is kept as it is
+            if (m_nodes.size() < 3) {
+                m_nodes.resize(size);
+                m_indices.resize(size);
+                for (size_t i{}; i < size; ++i) {
+                    m_nodes[i] = nodes[i];
+                    m_indices[i] = i;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Get simplified nodes
+        /// </summary>
+        /// <returns>readonly nodes</returns>
+        const std::vector<Point2<T>>& getNodes() const {
+            return m_nodes;
+        }
+
+        /// <summary>
+        /// Get view of simplified nodes, it is valid until next call of simplify
+        /// </summary>
+        /// <returns>view of nodes</returns>
+        PolygonView<T> getView() const {
+            static_assert(sizeof(Point2<T>) == 2 * sizeof(T), "Point2 must contain only x and y");
+            return m_nodes.empty() ? PolygonView<T>{} : PolygonView<T>(&m_nodes.front().x, &m_nodes.front().y, m_nodes.size(), 2);
+        }
+
+        /// <summary>
+        /// Get index in original polygon for every simplified node
+        /// </summary>
+        /// <returns>readonly indices in increasing order</returns>
+        const std::vector<size_t>& getIndices() const {
+            return m_indices;
+        }
+
+        /// <summary>
+        /// Map element of simplified polygon to element of original polygon at the same point.
+        /// Simplified node is original node. Middle of simplified edge is middle of run of original
+        /// edges, it is found among nodes and middles of edges of the run by binary search along
+        /// the run, which goes forward, in O(log N)
+        /// </summary>
+        /// <param name="nodes">nodes of original polygon that was simplified last</param>
+        /// <param name="position">position of element in edge/angle sequence of simplified polygon</param>
+        /// <param name="epsilon">presision, integer coords are compared exactly</param>
+        /// <returns>position of element of original polygon or SIZE_MAX if there is no element at the point</returns>
+        template <class Nodes>
+        size_t mapPosition(const Nodes& nodes, size_t position, double epsilon) const {
+            auto count { m_indices.size() };
+            auto first { m_indices[position / 2] };
+            if (position % 2 == 0) {
+                return 2 * first;
+            }
+
+            // element e of run is node first + e / 2 for even e and middle of its edge for odd e
+            auto size { nodes.size() };
+            auto last { m_indices[position / 2 + 1 < count ? position / 2 + 1 : 0] };
+            size_t elements { 2 * ((last + size - first - 1) % size + 1) };
+            auto get = [&](size_t e) {
+                auto index { (first + e / 2) % size };
+                Point2<T> a { nodes[index] };
+                Point2<double> point { double(a.x), double(a.y) };
+                if (e % 2 == 0) {
+                    return point;
+                }
+                Point2<T> b { nodes[index + 1 < size ? index + 1 : 0] };
+                return (point + Point2<double>(double(b.x), double(b.y))) / 2.0;
+            };
+            auto start { get(0) }, direction { get(elements) - start };
+            auto middle { start + direction / 2.0 };
+            double target { direction.dot(middle - start) };
+
+            size_t low{}, high { elements };
+            while (low < high) {
+                auto e { (low + high) / 2 };
+                if (direction.dot(get(e) - start) < target) {
+                    low = e + 1;
+                } else {
+                    high = e;
+                }
+            }
+            double presision { std::is_integral_v<T> ? 0.0 : epsilon };
+            for (auto e { low > 0 ? low - 1 : 0 }; e <= std::min(low + 1, elements); ++e) {
+                if (get(e).isEqual(middle, presision)) {
+                    return (2 * first + e) % (2 * size);
+                }
+            }
+            return SIZE_MAX;
+        }
+
+        /// <summary>
+        /// Get size of buffers
+        /// </summary>
+        /// <returns>count of bytes</returns>
+        size_t getMemorySize() const {
+            return m_nodes.capacity() * sizeof(Point2<T>) + m_indices.capacity() * sizeof(size_t);
+        }
+    private:
+        /// <summary>
+        /// Check that b lies on straight run from a to c: it goes forward and does not turn
+        /// </summary>
+        static bool isCollinear(const Point2<T>& a, const Point2<T>& b, const Point2<T>& c, double epsilon) {
+            auto in { b - a }, out { c - b };
+            if constexpr (std::is_integral_v<T>) {
+                return in.cross(out) == 0 && in.dot(out) > 0;
+            } else {
+                double inLength { std::sqrt(double(in.dot(in))) }, outLength { std::sqrt(double(out.dot(out))) };
+                return in.dot(out) > 0 && std::fabs(double(in.cross(out))) <= epsilon * inLength * outLength;
+            }
+        }
+
+        /// <summary>
+        /// Integer products are exact only for coords in [-2^30, 2^30] like in EdgeAngleSequence
+        /// </summary>
+        static void checkRange(const Point2<T>& node) {
+            if constexpr (std::is_integral_v<T>) {
+                constexpr T limit { T(1) << 30 };
+                if (node.x > limit || node.x < -limit || node.y > limit || node.y < -limit) {
+                    throw std::runtime_error("Integer coords must be in range [-2^30, 2^30]");
+                }
+            }
+        }
+
+        std::vector<Point2<T>> m_nodes;
+        std::vector<size_t> m_indices;
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Point2.hpp"
+#include "PolygonView.hpp"
+#include <vector>
+#include <cstddef>
+
+/// <summary>
+/// Polygon nodes stored as structure of arrays: all x coords and all y coords
+/// are contiguous, so they can be loaded by SIMD instructions.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class PolygonSoA {
+    public:
+        /// <summary>
+        /// base constructor
+        /// </summary>
+        PolygonSoA() {}
+
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="nodes">nodes of polygon</param>
+        template <class Nodes>
+        explicit PolygonSoA(const Nodes& nodes) {
+            assign(nodes);
+        }
+
+        /// <summary>
+        /// Copy nodes into arrays
+        /// </summary>
+        /// <param name="nodes">nodes of polygon</param>
+        template <class Nodes>
+        void assign(const Nodes& nodes) {
+            auto size { nodes.size() };
+            m_x.resize(size);
+            m_y.resize(size);
+
+            for (size_t i{}; i < size; ++i) {
+                Point2<T> node { nodes[i] };
+                m_x[i] = node.x;
+                m_y[i] = node.y;
+            }
+        }
+
+        /// <summary>
+        /// Get count of nodes
+        /// </summary>
+        /// <returns>count of nodes</returns>
+        size_t size() const {
+            return m_x.size();
+        }
+
+        /// <summary>
+        /// Get size of arrays of coords
+        /// </summary>
+        /// <returns>count of bytes</returns>
+        size_t getMemorySize() const {
+            return (m_x.capacity() + m_y.capacity()) * sizeof(T);
+        }
+
+        /// <summary>
+        /// Get node by index
+        /// </summary>
+        /// <param name="i">index of node</param>
+        /// <returns>node as point</returns>
+        Point2<T> operator[](size_t i) const {
+            return Point2<T>(m_x[i], m_y[i]);
+        }
+
+        /// <summary>
+        /// Get all x coords
+        /// </summary>
+        /// <returns>readonly x coords</returns>
+        const T* getX() const {
+            return m_x.data();
+        }
+
+        /// <summary>
+        /// Get all y coords
+        /// </summary>
+        /// <returns>readonly y coords</returns>
+        const T* getY() const {
+            return m_y.data();
+        }
+
+        /// <summary>
+        /// Get view of nodes without copy
+        /// </summary>
+        /// <returns>view that is valid while arrays are not changed</returns>
+        PolygonView<T> getView() const {
+            return PolygonView<T>(m_x.data(), m_y.data(), m_x.size());
+        }
+
+        /// <summary>
+        /// Move all nodes by point
+        /// </summary>
+        /// <param name="p">The point to which the polygon is moved</param>
+        void translate(const Point2<T>& p) {
+            for (size_t i{}; i < m_x.size(); ++i) {
+                m_x[i] -= p.x;
+                m_y[i] -= p.y;
+            }
+        }
+    private:
+        std::vector<T> m_x, m_y;
+};
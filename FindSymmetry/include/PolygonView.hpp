@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Point2.hpp"
+#include "Polygon.hpp"
+#include <cstddef>
+#include <vector>
+
+/// <summary>
+/// Non-owning readonly view of polygon nodes. View looks either at two coord arrays with stride
+/// (contiguous x/y columns have stride 1) or at nodes of Polygon, which are read as points.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class PolygonView {
+    public:
+        /// <summary>
+        /// base constructor
+        /// </summary>
+        PolygonView() {}
+
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="x">x coord of first node</param>
+        /// <param name="y">y coord of first node</param>
+        /// <param name="size">count of nodes</param>
+        /// <param name="stride">distance between coords of neighbour nodes</param>
+        PolygonView(const T* x, const T* y, size_t size, size_t stride = 1)
+            : m_x(x), m_y(y), m_size(size), m_stride(stride) {}
+
+        /// <summary>
+        /// Init constructor that looks at nodes of polygon
+        /// </summary>
+        /// <param name="p">polygon, it must live longer than view</param>
+        explicit PolygonView(const Polygon<T>& p)
+            : m_nodes(p.getNodes().data()), m_size(p.getNodes().size()) {}
+
+        /// <summary>
+        /// Get count of nodes
+        /// </summary>
+        /// <returns>count of nodes</returns>
+        size_t size() const {
+            return m_size;
+        }
+
+        /// <summary>
+        /// Get node by index
+        /// </summary>
+        /// <param name="i">index of node</param>
+        /// <returns>node as point</returns>
+        Point2<T> operator[](size_t i) const {
+            if (m_nodes != nullptr) {
+                return m_nodes[i];
+            }
+            return Point2<T>(m_x[i * m_stride], m_y[i * m_stride]);
+        }
+
+        /// <summary>
+        /// Copy nodes into polygon
+        /// </summary>
+        /// <returns>polygon with the same nodes</returns>
+        Polygon<T> toPolygon() const {
+            std::vector<Point2<T>> nodes(m_size);
+            for (size_t i{}; i < m_size; ++i) {
+                nodes[i] = (*this)[i];
+            }
+            return Polygon<T>{ std::move(nodes) };
+        }
+    private:
+        const T* m_x{};
+        const T* m_y{};
+        const Point2<T>* m_nodes{};
+        size_t m_size{};
+        size_t m_stride{ 1 };
+};
@@ -0,0 +1,342 @@
+#pragma once
+
+#include "Point2.hpp"
+#include "PolygonSoA.hpp"
+#include "PointIndex.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+#include <cstddef>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define FINDSYMMETRY_SSE2
+#endif
+
+/// <summary>
+/// Reflect points (x[i], y[i]) across line through (0, 0) with unit direction (dx, dy)
+/// and compare them with (tx[i], ty[i]) with presision epsilon like Point2::isEqual.
+/// Reflection of p is 2 * (p, d) * d - p, it is the same as rotation by pi around d.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+/// <param name="x">x coords of points</param>
+/// <param name="y">y coords of points</param>
+/// <param name="tx">x coords of targets</param>
+/// <param name="ty">y coords of targets</param>
+/// <param name="size">count of points</param>
+/// <param name="dx">x coord of axis direction</param>
+/// <param name="dy">y coord of axis direction</param>
+/// <param name="epsilon">presision</param>
+/// <returns>true if every reflected point is equal to its target else false</returns>
+template <class T>
+bool reflectAndCompareScalar(const T* x, const T* y, const T* tx, const T* ty,
+                             size_t size, T dx, T dy, double epsilon) {
+    for (size_t i{}; i < size; ++i) {
+        T twoDot { 2 * (x[i] * dx + y[i] * dy) };
+        T rx { twoDot * dx - x[i] }, ry { twoDot * dy - y[i] };
+
+        if (std::fabs(rx - tx[i]) > epsilon * std::max({ T(1), std::fabs(rx), std::fabs(tx[i]) }) ||
+            std::fabs(ry - ty[i]) > epsilon * std::max({ T(1), std::fabs(ry), std::fabs(ty[i]) })) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// <summary>
+/// Reflect points across axis and compare with targets, scalar version for any type
+/// </summary>
+template <class T>
+bool reflectAndCompare(const T* x, const T* y, const T* tx, const T* ty,
+                       size_t size, T dx, T dy, double epsilon) {
+    return reflectAndCompareScalar(x, y, tx, ty, size, dx, dy, epsilon);
+}
+
+/// <summary>
+/// Reflect points across axis and compare with targets by blocks of 4 (AVX2) or 2 (SSE2) lanes.
+/// Returns on first block with mismatched lane.
+/// </summary>
+inline bool reflectAndCompare(const double* x, const double* y, const double* tx, const double* ty,
+                              size_t size, double dx, double dy, double epsilon) {
+    size_t i{};
+#if defined(__AVX2__)
+    const __m256d vdx { _mm256_set1_pd(dx) }, vdy { _mm256_set1_pd(dy) }, two { _mm256_set1_pd(2.0) },
+                  one { _mm256_set1_pd(1.0) }, eps { _mm256_set1_pd(epsilon) }, sign { _mm256_set1_pd(-0.0) };
+    auto isEqual = [&](__m256d a, __m256d b) {
+        __m256d scale { _mm256_max_pd(one, _mm256_max_pd(_mm256_andnot_pd(sign, a), _mm256_andnot_pd(sign, b))) };
+        __m256d diff { _mm256_andnot_pd(sign, _mm256_sub_pd(a, b)) };
+        return _mm256_cmp_pd(diff, _mm256_mul_pd(eps, scale), _CMP_LE_OQ);
+    };
+
+    for (; i + 4 <= size; i += 4) {
+        __m256d px { _mm256_loadu_pd(x + i) }, py { _mm256_loadu_pd(y + i) };
+        __m256d twoDot { _mm256_mul_pd(two, _mm256_add_pd(_mm256_mul_pd(px, vdx), _mm256_mul_pd(py, vdy))) };
+        __m256d rx { _mm256_sub_pd(_mm256_mul_pd(twoDot, vdx), px) },
+                ry { _mm256_sub_pd(_mm256_mul_pd(twoDot, vdy), py) };
+        __m256d equal { _mm256_and_pd(isEqual(rx, _mm256_loadu_pd(tx + i)), isEqual(ry, _mm256_loadu_pd(ty + i))) };
+
+        if (_mm256_movemask_pd(equal) != 0xF) {
+            return false;
+        }
+    }
+#elif defined(FINDSYMMETRY_SSE2)
+    const __m128d vdx { _mm_set1_pd(dx) }, vdy { _mm_set1_pd(dy) }, two { _mm_set1_pd(2.0) },
+                  one { _mm_set1_pd(1.0) }, eps { _mm_set1_pd(epsilon) }, sign { _mm_set1_pd(-0.0) };
+    auto isEqual = [&](__m128d a, __m128d b) {
+        __m128d scale { _mm_max_pd(one, _mm_max_pd(_mm_andnot_pd(sign, a), _mm_andnot_pd(sign, b))) };
+        __m128d diff { _mm_andnot_pd(sign, _mm_sub_pd(a, b)) };
+        return _mm_cmple_pd(diff, _mm_mul_pd(eps, scale));
+    };
+
+    for (; i + 2 <= size; i += 2) {
+        __m128d px { _mm_loadu_pd(x + i) }, py { _mm_loadu_pd(y + i) };
+        __m128d twoDot { _mm_mul_pd(two, _mm_add_pd(_mm_mul_pd(px, vdx), _mm_mul_pd(py, vdy))) };
+        __m128d rx { _mm_sub_pd(_mm_mul_pd(twoDot, vdx), px) },
+                ry { _mm_sub_pd(_mm_mul_pd(twoDot, vdy), py) };
+        __m128d equal { _mm_and_pd(isEqual(rx, _mm_loadu_pd(tx + i)), isEqual(ry, _mm_loadu_pd(ty + i))) };
+
+        if (_mm_movemask_pd(equal) != 0x3) {
+            return false;
+        }
+    }
+#endif
+    return reflectAndCompareScalar(x + i, y + i, tx + i, ty + i, size - i, dx, dy, epsilon);
+}
+
+/// <summary>
+/// Reflect points across axis and compare with targets in single presision by blocks of 8 (AVX2)
+/// or 4 (SSE2) lanes, twice as many as in double. Returns on first block with mismatched lane.
+/// </summary>
+inline bool reflectAndCompare(const float* x, const float* y, const float* tx, const float* ty,
+                              size_t size, float dx, float dy, double epsilon) {
+    size_t i{};
+#if defined(__AVX2__)
+    const __m256 vdx { _mm256_set1_ps(dx) }, vdy { _mm256_set1_ps(dy) }, two { _mm256_set1_ps(2.0f) },
+                 one { _mm256_set1_ps(1.0f) }, eps { _mm256_set1_ps(float(epsilon)) }, sign { _mm256_set1_ps(-0.0f) };
+    auto isEqual = [&](__m256 a, __m256 b) {
+        __m256 scale { _mm256_max_ps(one, _mm256_max_ps(_mm256_andnot_ps(sign, a), _mm256_andnot_ps(sign, b))) };
+        __m256 diff { _mm256_andnot_ps(sign, _mm256_sub_ps(a, b)) };
+        return _mm256_cmp_ps(diff, _mm256_mul_ps(eps, scale), _CMP_LE_OQ);
+    };
+
+    for (; i + 8 <= size; i += 8) {
+        __m256 px { _mm256_loadu_ps(x + i) }, py { _mm256_loadu_ps(y + i) };
+        __m256 twoDot { _mm256_mul_ps(two, _mm256_add_ps(_mm256_mul_ps(px, vdx), _mm256_mul_ps(py, vdy))) };
+        __m256 rx { _mm256_sub_ps(_mm256_mul_ps(twoDot, vdx), px) },
+               ry { _mm256_sub_ps(_mm256_mul_ps(twoDot, vdy), py) };
+        __m256 equal { _mm256_and_ps(isEqual(rx, _mm256_loadu_ps(tx + i)), isEqual(ry, _mm256_loadu_ps(ty + i))) };
+
+        if (_mm256_movemask_ps(equal) != 0xFF) {
+            return false;
+        }
+    }
+#elif defined(FINDSYMMETRY_SSE2)
+    const __m128 vdx { _mm_set1_ps(dx) }, vdy { _mm_set1_ps(dy) }, two { _mm_set1_ps(2.0f) },
+                 one { _mm_set1_ps(1.0f) }, eps { _mm_set1_ps(float(epsilon)) }, sign { _mm_set1_ps(-0.0f) };
+    auto isEqual = [&](__m128 a, __m128 b) {
+        __m128 scale { _mm_max_ps(one, _mm_max_ps(_mm_andnot_ps(sign, a), _mm_andnot_ps(sign, b))) };
+        __m128 diff { _mm_andnot_ps(sign, _mm_sub_ps(a, b)) };
+        return _mm_cmple_ps(diff, _mm_mul_ps(eps, scale));
+    };
+
+    for (; i + 4 <= size; i += 4) {
+        __m128 px { _mm_loadu_ps(x + i) }, py { _mm_loadu_ps(y + i) };
+        __m128 twoDot { _mm_mul_ps(two, _mm_add_ps(_mm_mul_ps(px, vdx), _mm_mul_ps(py, vdy))) };
+        __m128 rx { _mm_sub_ps(_mm_mul_ps(twoDot, vdx), px) },
+               ry { _mm_sub_ps(_mm_mul_ps(twoDot, vdy), py) };
+        __m128 equal { _mm_and_ps(isEqual(rx, _mm_loadu_ps(tx + i)), isEqual(ry, _mm_loadu_ps(ty + i))) };
+
+        if (_mm_movemask_ps(equal) != 0xF) {
+            return false;
+        }
+    }
+#endif
+    return reflectAndCompareScalar(x + i, y + i, tx + i, ty + i, size - i, dx, dy, epsilon);
+}
+
+/// <summary>
+/// Nodes of polygon with center in (0, 0) prepared for reflect-and-compare kernel:
+/// nodes in direct and back order are repeated twice, so targets of any cyclic
+/// shift are contiguous.
+/// Targets can also keep single presision copy of nodes normalized to unit box (buildScreen):
+/// then every axis is screened by float kernel with widened tolerance and only survivors
+/// are verified in double, so results are the same as without screen.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class ReflectionTargets {
+    public:
+        /// <summary>
+        /// base constructor, targets must be built before use
+        /// </summary>
+        ReflectionTargets() {}
+
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="nodes">nodes of polygon with center in (0, 0)</param>
+        /// <param name="index">index over nodes, it must live longer than targets</param>
+        template <class Nodes>
+        ReflectionTargets(const Nodes& nodes, const PointIndex<T>& index) {
+            build(nodes, index);
+        }
+
+        /// <summary>
+        /// Prepare targets, memory of previous build is reused
+        /// </summary>
+        /// <param name="nodes">nodes of polygon with center in (0, 0)</param>
+        /// <param name="index">index over nodes, it must live longer than targets</param>
+        template <class Nodes>
+        void build(const Nodes& nodes, const PointIndex<T>& index) {
+            build(nodes);
+            m_index = &index;
+        }
+
+        /// <summary>
+        /// Prepare targets without index, they are used only by isMirror
+        /// </summary>
+        /// <param name="nodes">nodes of polygon with center in (0, 0)</param>
+        template <class Nodes>
+        void build(const Nodes& nodes) {
+            m_nodes.assign(nodes);
+            m_index = nullptr;
+            auto size { m_nodes.size() };
+            m_forwardX.resize(2 * size);
+            m_forwardY.resize(2 * size);
+            m_backwardX.resize(2 * size);
+            m_backwardY.resize(2 * size);
+
+            for (size_t i{}; i < 2 * size; ++i) {
+                m_forwardX[i] = m_nodes.getX()[i % size];
+                m_forwardY[i] = m_nodes.getY()[i % size];
+                m_backwardX[i] = m_nodes.getX()[size - 1 - i % size];
+                m_backwardY[i] = m_nodes.getY()[size - 1 - i % size];
+            }
+            m_screen = false;
+        }
+
+        /// <summary>
+        /// Prepare single presision screen of built targets. Nodes are divided by the biggest coord,
+        /// so float keeps the same relative presision for 1e12 and 1e-12 scales. Tolerance of
+        /// Point2::isEqual is relative to max(1, |coord|), in unit box it is at most
+        /// epsilon * max(1, 1 / scale), and it is widened by rounding errors of float
+        /// </summary>
+        /// <param name="epsilon">presision of double verification</param>
+        void buildScreen(double epsilon) {
+            auto size { m_nodes.size() };
+            double scale{};
+            for (size_t i{}; i < size; ++i) {
+                scale = std::max({ scale, std::fabs(double(m_nodes.getX()[i])), std::fabs(double(m_nodes.getY()[i])) });
+            }
+            m_screenTolerance = 2 * epsilon * std::max(1.0, scale > 0 ? 1 / scale : 1.0) + 32 * FLT_EPSILON;
+            // screen with such tolerance rejects nothing
+            m_screen = scale > 0 && m_screenTolerance < 0.5;
+            if (!m_screen) {
+                return;
+            }
+
+            m_screenForwardX.resize(2 * size);
+            m_screenForwardY.resize(2 * size);
+            m_screenBackwardX.resize(2 * size);
+            m_screenBackwardY.resize(2 * size);
+            for (size_t i{}; i < 2 * size; ++i) {
+                m_screenForwardX[i] = float(m_forwardX[i] / scale);
+                m_screenForwardY[i] = float(m_forwardY[i] / scale);
+                m_screenBackwardX[i] = float(m_backwardX[i] / scale);
+                m_screenBackwardY[i] = float(m_backwardY[i] / scale);
+            }
+        }
+
+        /// <summary>
+        /// Get nodes of polygon
+        /// </summary>
+        /// <returns>readonly nodes</returns>
+        const PolygonSoA<T>& getNodes() const {
+            return m_nodes;
+        }
+
+        /// <summary>
+        /// Get size of buffers of targets
+        /// </summary>
+        /// <returns>count of bytes</returns>
+        size_t getMemorySize() const {
+            return m_nodes.getMemorySize() + (m_forwardX.capacity() + m_forwardY.capacity() +
+                                              m_backwardX.capacity() + m_backwardY.capacity()) * sizeof(T) +
+                   (m_screenForwardX.capacity() + m_screenForwardY.capacity() +
+                    m_screenBackwardX.capacity() + m_screenBackwardY.capacity()) * sizeof(float);
+        }
+
+        /// <summary>
+        /// Check that reflection across line through (0, 0) maps polygon to itself.
+        /// Shift and order of nodes are found like in Polygon::isEqual, then all nodes
+        /// are compared by vectorized kernel. Epsilon must be the same as in index.
+        /// </summary>
+        /// <param name="direction">unit direction of axis</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>true if line is axis of symmetry else false</returns>
+        bool isAxis(const Point2<T>& direction, double epsilon) const {
+            auto size { m_nodes.size() };
+            if (size == 0) {
+                return true;
+            }
+
+            auto start { m_index->find(reflect(m_nodes[0], direction)) };
+            if (start == PointIndex<T>::npos) {
+                return false;
+            }
+
+            // target of node i is node (start + i) mod size or node (start - i) mod size
+            bool backward { size > 1 && !reflect(m_nodes[1], direction).isEqual(m_nodes[start + 1 < size ? start + 1 : 0], epsilon) };
+            return compare(direction, backward, backward ? size - 1 - start : start, epsilon);
+        }
+
+        /// <summary>
+        /// Check reflection whose order of nodes is known, for example from matched shift of
+        /// edge/angle sequence: node i must be mapped to node (target - i) mod size
+        /// </summary>
+        /// <param name="direction">unit direction of axis</param>
+        /// <param name="target">index of node that node 0 is mapped to</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>true if all reflected nodes are equal to their targets else false</returns>
+        bool isMirror(const Point2<T>& direction, size_t target, double epsilon) const {
+            auto size { m_nodes.size() };
+            if (size == 0) {
+                return true;
+            }
+            return compare(direction, true, size - 1 - target % size, epsilon);
+        }
+    private:
+        bool compare(const Point2<T>& direction, bool backward, size_t offset, double epsilon) const {
+            auto size { m_nodes.size() };
+            if (m_screen) {
+                const auto& x { backward ? m_screenBackwardX : m_screenForwardX };
+                const auto& y { backward ? m_screenBackwardY : m_screenForwardY };
+                if (!reflectAndCompare(m_screenForwardX.data(), m_screenForwardY.data(), x.data() + offset, y.data() + offset,
+                                       size, float(direction.x), float(direction.y), m_screenTolerance)) {
+                    return false;
+                }
+            }
+
+            const auto& x { backward ? m_backwardX : m_forwardX };
+            const auto& y { backward ? m_backwardY : m_forwardY };
+            return reflectAndCompare(m_nodes.getX(), m_nodes.getY(), x.data() + offset, y.data() + offset,
+                                     size, direction.x, direction.y, epsilon);
+        }
+
+        static Point2<T> reflect(const Point2<T>& p, const Point2<T>& direction) {
+            T twoDot { 2 * (p.x * direction.x + p.y * direction.y) };
+            return Point2<T>(twoDot * direction.x - p.x, twoDot * direction.y - p.y);
+        }
+
+        PolygonSoA<T> m_nodes;
+        const PointIndex<T>* m_index{};
+        std::vector<T> m_forwardX, m_forwardY;
+        std::vector<T> m_backwardX, m_backwardY;
+        bool m_screen{};
+        double m_screenTolerance{};
+        std::vector<float> m_screenForwardX, m_screenForwardY;
+        std::vector<float> m_screenBackwardX, m_screenBackwardY;
+};
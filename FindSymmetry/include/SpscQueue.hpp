@@ -0,0 +1,128 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// Bounded lock-free queue for one producer thread and one consumer thread.
+/// Ring buffer has capacity that is power of 2, head is written only by consumer and tail only
+/// by producer, so push and pop are one acquire load and one release store.
+/// Blocking push waits while queue is full, so slow consumer slows down producer (backpressure).
+/// </summary>
+/// <typeparam name="T">default constructible and movable type</typeparam>
+template <class T>
+class SpscQueue {
+    public:
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="capacity">max count of items, it is rounded up to power of 2</param>
+        explicit SpscQueue(size_t capacity) {
+            size_t size { 2 };
+            while (size < capacity) {
+                size <<= 1;
+            }
+            m_items.resize(size);
+            m_mask = size - 1;
+        }
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        /// <summary>
+        /// Get max count of items
+        /// </summary>
+        /// <returns>capacity</returns>
+        size_t capacity() const {
+            return m_items.size();
+        }
+
+        /// <summary>
+        /// Push item if queue is not full, called only by producer
+        /// </summary>
+        /// <param name="item">pushed item, it is moved only on success</param>
+        /// <returns>true if item is pushed else false</returns>
+        bool tryPush(T& item) {
+            auto tail { m_tail.load(std::memory_order_relaxed) };
+            if (tail - m_head.load(std::memory_order_acquire) == m_items.size()) {
+                return false;
+            }
+            m_items[tail & m_mask] = std::move(item);
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// <summary>
+        /// Push item, wait while queue is full, called only by producer
+        /// </summary>
+        /// <param name="item">pushed item</param>
+        /// <returns>false if queue is closed and item is dropped else true</returns>
+        bool push(T item) {
+            for (size_t spin{}; !m_closed.load(std::memory_order_acquire); ++spin) {
+                if (tryPush(item)) {
+                    return true;
+                }
+                backOff(spin);
+            }
+            return false;
+        }
+
+        /// <summary>
+        /// Pop item if queue is not empty, called only by consumer
+        /// </summary>
+        /// <param name="item">output: popped item</param>
+        /// <returns>true if item is popped else false</returns>
+        bool tryPop(T& item) {
+            auto head { m_head.load(std::memory_order_relaxed) };
+            if (head == m_tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+            item = std::move(m_items[head & m_mask]);
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// <summary>
+        /// Pop item, wait while queue is empty and not closed, called only by consumer
+        /// </summary>
+        /// <param name="item">output: popped item</param>
+        /// <returns>false if queue is closed and empty else true</returns>
+        bool pop(T& item) {
+            for (size_t spin{}; !tryPop(item); ++spin) {
+                if (m_closed.load(std::memory_order_acquire)) {
+                    // items pushed before close are still popped
+                    return tryPop(item);
+                }
+                backOff(spin);
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Close queue: consumer pops remaining items and then stops, producer stops pushing
+        /// </summary>
+        void close() {
+            m_closed.store(true, std::memory_order_release);
+        }
+    private:
+        /// <summary>
+        /// Wait of blocked thread: yield first, then sleep, so waiting stage does not take core
+        /// </summary>
+        static void backOff(size_t spin) {
+            if (spin < 64) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+
+        std::vector<T> m_items;
+        size_t m_mask{};
+        alignas(64) std::atomic<size_t> m_head{};
+        alignas(64) std::atomic<size_t> m_tail{};
+        alignas(64) std::atomic<bool> m_closed{};
+};
@@ -0,0 +1,382 @@
+#pragma once
+
+#include "Point2.hpp"
+#include "Polygon.hpp"
+#include "PolygonView.hpp"
+#include "Axis.hpp"
+#include "CompactAxis.hpp"
+#include "EdgeAngleSequence.hpp"
+#include "SymmetryFinder.hpp"
+#include "SymmetryWorkspace.hpp"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// LRU cache of axes of symmetry for workloads with repeated shapes.
+/// Key is hash of canonical form of quantized edge/angle sequence: the sequence does not depend
+/// on translation and rotation, minimal cyclic rotation (Booth's algorithm) removes start index,
+/// and minimum over forward/back order and sign of turns removes orientation and mirroring.
+/// Hit is confirmed like Polygon::isEqual: cached polygon is moved on query polygon by rigid
+/// transform that is given by matched canonical forms, and all nodes must be equal with presision
+/// epsilon. Cached axes are stored as positions of elements, so they are mapped into frame of
+/// query polygon through the same correspondence and built from its nodes.
+/// Copies near boundary of quantization cell can get other key, they are computed again.
+/// Cache is not thread safe.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class SymmetryCache {
+    public:
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="capacity">max count of cached polygons</param>
+        /// <param name="resolution">size of quantization cell of tokens relative to the biggest token,
+        /// it is not less than epsilon of query. Integer tokens are not quantized</param>
+        explicit SymmetryCache(size_t capacity = 1024, double resolution = 1e-6)
+            : m_capacity(std::max<size_t>(capacity, 1)), m_resolution(resolution) {}
+
+        /// <summary>
+        /// Find axes of symmetry, cached result is used when congruent polygon was found before
+        /// </summary>
+        /// <param name="p">polygon</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>vector with axes of symmetry</returns>
+        std::vector<Axis<RealOf<T>>> findSymmetry(const Polygon<T>& p, double epsilon) {
+            return findSymmetry(PolygonView<T>(p), epsilon);
+        }
+
+        /// <summary>
+        /// Find axes of symmetry of polygon that is not owned, cached result is used
+        /// when congruent polygon was found before
+        /// </summary>
+        /// <param name="p">view of polygon</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>vector with axes of symmetry</returns>
+        std::vector<Axis<RealOf<T>>> findSymmetry(const PolygonView<T>& p, double epsilon) {
+            if (p.size() < 3) {
+                ++m_misses;
+                return m_finder.findSymmetry(p, epsilon);
+            }
+
+            auto canonical { getCanonical(p, epsilon) };
+            auto key { getKey(p.size(), epsilon) };
+            auto found { m_index.find(key) };
+            if (found != m_index.end()) {
+                auto entry { found->second };
+                if (entry->epsilon == epsilon && isCongruent(*entry, p, canonical, epsilon)) {
+                    ++m_hits;
+                    m_entries.splice(m_entries.begin(), m_entries, entry);
+                    m_mapped.clear();
+                    for (const auto& axis : entry->axes) {
+                        m_mapped.push_back(CompactAxis{ mapPosition(axis.first, entry->canonical, canonical, p.size()),
+                                                        mapPosition(axis.second, entry->canonical, canonical, p.size()) });
+                    }
+                    return SymmetryFinder<T>::toAxes(p, m_mapped);
+                }
+                // other shape or other epsilon with the same key is replaced by new result
+                ++m_collisions;
+                m_entries.erase(entry);
+                m_index.erase(found);
+            }
+
+            ++m_misses;
+            const auto& compact { m_finder.findSymmetryCompact(p, epsilon, m_workspace) };
+            m_entries.push_front(Entry{ key, epsilon, p.toPolygon(), canonical, compact });
+            m_index[key] = m_entries.begin();
+            if (m_entries.size() > m_capacity) {
+                m_index.erase(m_entries.back().key);
+                m_entries.pop_back();
+            }
+            return SymmetryFinder<T>::toAxes(p, compact);
+        }
+
+        /// <summary>
+        /// Get count of queries that were answered from cache
+        /// </summary>
+        /// <returns>count of hits</returns>
+        size_t getHits() const {
+            return m_hits;
+        }
+
+        /// <summary>
+        /// Get count of queries that were computed
+        /// </summary>
+        /// <returns>count of misses</returns>
+        size_t getMisses() const {
+            return m_misses;
+        }
+
+        /// <summary>
+        /// Get count of queries whose key was found, but cached polygon was not congruent.
+        /// They are counted in misses too
+        /// </summary>
+        /// <returns>count of collisions</returns>
+        size_t getCollisions() const {
+            return m_collisions;
+        }
+
+        /// <summary>
+        /// Get count of cached polygons
+        /// </summary>
+        /// <returns>count of polygons</returns>
+        size_t size() const {
+            return m_entries.size();
+        }
+
+        /// <summary>
+        /// Get max count of cached polygons
+        /// </summary>
+        /// <returns>capacity</returns>
+        size_t capacity() const {
+            return m_capacity;
+        }
+
+        /// <summary>
+        /// Remove all cached polygons and set counters to 0
+        /// </summary>
+        void clear() {
+            m_entries.clear();
+            m_index.clear();
+            m_hits = m_misses = m_collisions = 0;
+        }
+    private:
+        /// <summary>
+        /// Quantized token of edge/angle sequence
+        /// </summary>
+        struct Token {
+            bool isVertex;
+            int64_t first, second;
+
+            friend bool operator==(const Token& a, const Token& b) {
+                return a.isVertex == b.isVertex && a.first == b.first && a.second == b.second;
+            }
+
+            friend bool operator<(const Token& a, const Token& b) {
+                if (a.isVertex != b.isVertex) {
+                    return a.isVertex < b.isVertex;
+                }
+                return a.first != b.first ? a.first < b.first : a.second < b.second;
+            }
+        };
+
+        /// <summary>
+        /// Variant of sequence that gives canonical form: element at canonical position c is
+        /// element at position (c + rotation) of sequence, which is read in back order when reversed.
+        /// Flipped variant has opposite sign of turns
+        /// </summary>
+        struct Canonical {
+            bool reversed;
+            bool flipped;
+            size_t rotation;
+        };
+
+        struct Entry {
+            uint64_t key;
+            double epsilon;
+            Polygon<T> polygon;
+            Canonical canonical;
+            std::vector<CompactAxis> axes;
+        };
+
+        /// <summary>
+        /// Get element of sequence at position of variant
+        /// </summary>
+        static size_t getElement(size_t position, bool reversed, size_t length) {
+            return reversed && position != 0 ? length - position : position;
+        }
+
+        /// <summary>
+        /// Map position of element of one polygon to position of element of congruent polygon
+        /// </summary>
+        static uint32_t mapPosition(size_t position, const Canonical& from, const Canonical& to, size_t size) {
+            auto length { 2 * size };
+            auto c { (getElement(position, from.reversed, length) + length - from.rotation) % length };
+            return static_cast<uint32_t>(getElement((c + to.rotation) % length, to.reversed, length));
+        }
+
+        /// <summary>
+        /// Quantize tokens of polygon and find canonical form among 4 variants in O(N)
+        /// </summary>
+        Canonical getCanonical(const PolygonView<T>& p, double epsilon) {
+            m_sequence.build(p);
+            const auto& tokens { m_sequence.getTokens() };
+            auto length { tokens.size() };
+
+            double quantum { 1 };
+            if constexpr (!std::is_integral_v<T>) {
+                // congruent polygons have the same tokens, so scale of quantization does not depend on frame
+                double scale { 1 };
+                for (const auto& token : tokens) {
+                    scale = std::max({ scale, std::fabs(double(token.first)), std::fabs(double(token.second)) });
+                }
+                quantum = std::max({ m_resolution, epsilon, 1e-15 }) * scale;
+            }
+            auto quantize = [quantum](T value) {
+                if constexpr (std::is_integral_v<T>) {
+                    return int64_t(value);
+                } else {
+                    return int64_t(std::llround(double(value) / quantum));
+                }
+            };
+            m_quantized.resize(length);
+            for (size_t i{}; i < length; ++i) {
+                m_quantized[i] = Token{ tokens[i].isVertex, quantize(tokens[i].first), quantize(tokens[i].second) };
+            }
+
+            Canonical best{};
+            for (int variant{}; variant < 4; ++variant) {
+                Canonical canonical { variant / 2 == 1, variant % 2 == 1, 0 };
+                m_variant.resize(length);
+                for (size_t q{}; q < length; ++q) {
+                    auto token { m_quantized[getElement(q, canonical.reversed, length)] };
+                    if (canonical.flipped && token.isVertex) {
+                        token.second = -token.second;
+                    }
+                    m_variant[q] = token;
+                }
+                canonical.rotation = findMinimalRotation(m_variant);
+                if (variant == 0 || isLess(m_variant, canonical.rotation, m_best)) {
+                    m_best.resize(length);
+                    for (size_t c{}; c < length; ++c) {
+                        m_best[c] = m_variant[(c + canonical.rotation) % length];
+                    }
+                    best = canonical;
+                }
+            }
+            return best;
+        }
+
+        /// <summary>
+        /// Booth's algorithm: start of lexicographically minimal cyclic rotation in O(N)
+        /// </summary>
+        size_t findMinimalRotation(const std::vector<Token>& tokens) {
+            auto length { tokens.size() };
+            m_failure.assign(2 * length, -1);
+            size_t k{};
+            for (size_t j{ 1 }; j < 2 * length; ++j) {
+                const auto& token { tokens[j % length] };
+                auto i { m_failure[j - k - 1] };
+                while (i != -1 && !(token == tokens[(k + i + 1) % length])) {
+                    if (token < tokens[(k + i + 1) % length]) {
+                        k = j - i - 1;
+                    }
+                    i = m_failure[i];
+                }
+                if (i == -1 && !(token == tokens[k % length])) {
+                    if (token < tokens[k % length]) {
+                        k = j;
+                    }
+                    m_failure[j - k] = -1;
+                } else {
+                    m_failure[j - k] = i + 1;
+                }
+            }
+            return k % length;
+        }
+
+        /// <summary>
+        /// Compare rotation of tokens with canonical form
+        /// </summary>
+        static bool isLess(const std::vector<Token>& tokens, size_t rotation, const std::vector<Token>& best) {
+            auto length { tokens.size() };
+            for (size_t c{}; c < length; ++c) {
+                const auto& token { tokens[(c + rotation) % length] };
+                if (!(token == best[c])) {
+                    return token < best[c];
+                }
+            }
+            return false;
+        }
+
+        /// <summary>
+        /// Hash of canonical form, count of nodes and epsilon
+        /// </summary>
+        uint64_t getKey(size_t size, double epsilon) const {
+            uint64_t bits{};
+            std::memcpy(&bits, &epsilon, sizeof(bits));
+            uint64_t hash { mix(0x9e3779b97f4a7c15ull ^ size) ^ mix(bits) };
+            for (const auto& token : m_best) {
+                hash = mix(hash ^ (uint64_t(token.first) + (token.isVertex ? 0x632be59bd9b4e019ull : 0)));
+                hash = mix(hash ^ uint64_t(token.second));
+            }
+            return hash;
+        }
+
+        /// <summary>
+        /// Finalizer of splitmix64
+        /// </summary>
+        static uint64_t mix(uint64_t value) {
+            value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+            value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+            return value ^ (value >> 31);
+        }
+
+        /// <summary>
+        /// Check that rigid transform given by canonical forms moves every node of cached polygon
+        /// on corresponding node of query polygon with presision epsilon
+        /// </summary>
+        static bool isCongruent(const Entry& entry, const PolygonView<T>& p, const Canonical& canonical, double epsilon) {
+            const auto& nodes { entry.polygon.getNodes() };
+            auto size { nodes.size() };
+            if (size != p.size()) {
+                return false;
+            }
+            auto get = [](const Point2<T>& node) {
+                return std::complex<double>(double(node.x), double(node.y));
+            };
+
+            // mirrored polygon has opposite sign of turns, and back order of nodes negates turns too,
+            // so polygons are mirrored when their variants differ by odd count of flips and reverses
+            bool mirror { (entry.canonical.reversed != entry.canonical.flipped) != (canonical.reversed != canonical.flipped) };
+            std::complex<double> from{}, to{};
+            for (size_t i{}; i < size; ++i) {
+                from += get(nodes[i]);
+                to += get(p[i]);
+            }
+            from /= double(size);
+            to /= double(size);
+
+            std::complex<double> rotation{};
+            for (size_t i{}; i < size; ++i) {
+                auto source { get(nodes[i]) - from };
+                auto target { get(p[mapPosition(2 * i, entry.canonical, canonical, size) / 2]) - to };
+                rotation += target * std::conj(mirror ? std::conj(source) : source);
+            }
+            rotation = std::abs(rotation) > 0 ? rotation / std::abs(rotation) : std::complex<double>(1);
+
+            // integer coords are compared exactly by finder, here moved nodes are not integer
+            double presision { std::is_integral_v<T> ? 1e-9 : epsilon };
+            for (size_t i{}; i < size; ++i) {
+                auto source { get(nodes[i]) - from };
+                auto moved { rotation * (mirror ? std::conj(source) : source) + to };
+                Point2<T> target { p[mapPosition(2 * i, entry.canonical, canonical, size) / 2] };
+                if (!Point2<double>(moved.real(), moved.imag()).isEqual(Point2<double>(double(target.x), double(target.y)), presision)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        size_t m_capacity;
+        double m_resolution;
+        SymmetryFinder<T> m_finder{};
+        SymmetryWorkspace<T> m_workspace{};
+        std::list<Entry> m_entries{};
+        std::unordered_map<uint64_t, typename std::list<Entry>::iterator> m_index{};
+        size_t m_hits{}, m_misses{}, m_collisions{};
+
+        // reused buffers of key
+        EdgeAngleSequence<T> m_sequence{};
+        std::vector<Token> m_quantized{}, m_variant{}, m_best{};
+        std::vector<ptrdiff_t> m_failure{};
+        std::vector<CompactAxis> m_mapped{};
+};
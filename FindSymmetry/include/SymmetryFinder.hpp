@@ -1,91 +1,946 @@
 #pragma once
 
 #include "Polygon.hpp"
+#include "PolygonView.hpp"
 #include "Axis.hpp"
+#include "CompactAxis.hpp"
+#include "EdgeAngleSequence.hpp"
+#include "CyclicMatcher.hpp"
+#include "ThreadPool.hpp"
+#include "ReflectKernel.hpp"
+#include "InvariantSignature.hpp"
+#include "CandidateProbe.hpp"
+#include "Counter.hpp"
+#include "SymmetryStats.hpp"
+#include "SymmetryGroup.hpp"
+#include "SymmetryWorkspace.hpp"
+#include <algorithm>
+#include <cmath>
 #include <numbers>
+#include <span>
+#include <type_traits>
 
 /// <summary>
-/// Main class that finds axes of symmetry
+/// Algorithm that is used for find axes of symmetry
+/// </summary>
+enum class SymmetryEngine {
+    /// <summary>
+    /// Match edge/angle sequence of polygon against its reverse in O(N), then check matched
+    /// axes by positions of nodes (AxisVerifier).
+    /// Tokens are compared one by one with presision relative to max(1, |a|, |b|) and KMP runs with
+    /// this equality although it is not transitive, so tolerance is defined on tokens, not on nodes
+    /// like in Vectorized and Reference engines. Near epsilon results can differ: with noise of nodes
+    /// 0.25 * epsilon Linear reported extra axes in about 5% of random cases and missed an axis at least
+    /// once. Use Vectorized or Reference when axes must match tolerance on nodes exactly
+    /// </summary>
+    Linear,
+    /// <summary>
+    /// Reflect polygon across every candidate by SIMD kernel over structure of arrays, O(N^2)
+    /// </summary>
+    Vectorized,
+    /// <summary>
+    /// Like Vectorized, but every candidate is screened by float kernel on polygon normalized
+    /// to unit box with twice as many lanes, only survivors are verified in double, O(N^2)
+    /// </summary>
+    MixedPrecision,
+    /// <summary>
+    /// Rotate polygon around every candidate and compare, O(N^2). Used for cross-checking
+    /// </summary>
+    Reference
+};
+
+/// <summary>
+/// How often invariant signature rejected polygon before candidates are evaluated
+/// </summary>
+struct PrefilterStats {
+    size_t checked;
+    size_t rejected;
+};
+
+/// <summary>
+/// Main class that finds axes of symmetry.
+/// For integer T (for example int64_t) polygon is always matched by exact edge/angle
+/// sequence of dot and cross products: there are no trig, square roots, divisions and epsilon,
+/// engine is ignored. Axes are returned in double, because middle of edge is half-integer
 /// </summary>
 /// <typeparam name="T">template parameter</typeparam>
-template <class T>
+/// <typeparam name="StatsPolicy">NoStats or SymmetryStats, NoStats has no overhead</typeparam>
+template <class T, class StatsPolicy = NoStats>
 class SymmetryFinder {
     public:
+        /// <summary>
+        /// Polygons with less count of nodes are not simplified by default,
+        /// small polygons gain little from simplification
+        /// </summary>
+        static constexpr size_t kDefaultSimplifyThreshold { 4096 };
+
+        /// <summary>
+        /// base constructor
+        /// </summary>
+        SymmetryFinder() : SymmetryFinder(SymmetryEngine::Linear) {}
+
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="engine">algorithm for find axes</param>
+        explicit SymmetryFinder(SymmetryEngine engine) : m_engine(engine) {}
+
+        /// <summary>
+        /// Get algorithm for find axes
+        /// </summary>
+        /// <returns>used engine</returns>
+        SymmetryEngine getEngine() const {
+            return m_engine;
+        }
+
+        /// <summary>
+        /// Set algorithm for find axes
+        /// </summary>
+        /// <param name="engine">used engine</param>
+        void setEngine(SymmetryEngine engine) {
+            m_engine = engine;
+        }
+
         /// <summary>
         /// Method for find axes of symmetry 
         /// </summary>
         /// <param name="p">Copy of polygon</param>
         /// <param name="epsilon">presision</param>
         /// <returns>vector with axes of symmetry</returns>
-        std::vector<Axis<T>> findSymmetry(Polygon<T> p, double epsilon) {
-            
+        std::vector<Axis<RealOf<T>>> findSymmetry(Polygon<T> p, double epsilon) const {
+            return findSymmetry(PolygonView<T>(p), epsilon);
+        }
+
+        /// <summary>
+        /// Method for find axes of symmetry of polygon that is not owned.
+        /// Linear engine reads nodes through view without copy
+        /// </summary>
+        /// <param name="p">view of polygon</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>vector with axes of symmetry</returns>
+        std::vector<Axis<RealOf<T>>> findSymmetry(const PolygonView<T>& p, double epsilon) const {
+            SymmetryWorkspace<T> workspace{};
+            findSymmetry(p, epsilon, workspace);
+            return std::move(workspace.m_axes);
+        }
+
+        /// <summary>
+        /// Method for find axes of symmetry with buffers of caller. When workspace is reused,
+        /// after warm-up call makes no heap allocations
+        /// </summary>
+        /// <param name="p">view of polygon</param>
+        /// <param name="epsilon">presision</param>
+        /// <param name="workspace">reused buffers</param>
+        /// <returns>axes of symmetry, they live in workspace until next call</returns>
+        const std::vector<Axis<RealOf<T>>>& findSymmetry(const PolygonView<T>& p, double epsilon, SymmetryWorkspace<T>& workspace) const {
+            findSymmetryCompact(p, epsilon, workspace);
+            toAxes(p, workspace.m_compact, workspace.m_axes);
+            return workspace.m_axes;
+        }
+
+        /// <summary>
+        /// Find axes of symmetry as positions of polygon elements, endpoints are not built.
+        /// Positions are positions of elements of polygon itself also when it is simplified
+        /// </summary>
+        /// <param name="p">polygon</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>vector with compact axes of symmetry</returns>
+        std::vector<CompactAxis> findSymmetryCompact(const Polygon<T>& p, double epsilon) const {
+            return findSymmetryCompact(PolygonView<T>(p), epsilon);
+        }
+
+        /// <summary>
+        /// Find axes of symmetry of polygon that is not owned as positions of polygon elements
+        /// </summary>
+        /// <param name="p">view of polygon</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>vector with compact axes of symmetry</returns>
+        std::vector<CompactAxis> findSymmetryCompact(const PolygonView<T>& p, double epsilon) const {
+            SymmetryWorkspace<T> workspace{};
+            findSymmetryCompact(p, epsilon, workspace);
+            return std::move(workspace.m_compact);
+        }
+
+        /// <summary>
+        /// Find axes of symmetry as positions of polygon elements with buffers of caller
+        /// </summary>
+        /// <param name="p">view of polygon</param>
+        /// <param name="epsilon">presision</param>
+        /// <param name="workspace">reused buffers</param>
+        /// <returns>compact axes of symmetry, they live in workspace until next call</returns>
+        const std::vector<CompactAxis>& findSymmetryCompact(const PolygonView<T>& p, double epsilon, SymmetryWorkspace<T>& workspace) const {
+            size_t memory{};
+            if constexpr (StatsPolicy::enabled) {
+                memory = workspace.getMemorySize();
+            }
+
+            // polygon is matched without duplicate and collinear nodes, then elements of axes
+            // are mapped back to original nodes and middles of edges
+            auto nodes { p };
+            bool simplified { p.size() >= m_simplifyThreshold };
+            if (simplified) {
+                PhaseTimer<StatsPolicy> timer { m_stats, SymmetryPhase::Simplify };
+                workspace.m_simplifier.simplify(p, epsilon);
+                nodes = workspace.m_simplifier.getView();
+            }
+
+            if constexpr (std::is_integral_v<T>) {
+                findSymmetryLinear(nodes, epsilon, workspace);
+            } else {
+                if (m_engine == SymmetryEngine::Linear) {
+                    findSymmetryLinear(nodes, epsilon, workspace);
+                } else {
+                    findSymmetryCandidates(nodes, epsilon, workspace);
+                }
+            }
+
+            if (simplified) {
+                PhaseTimer<StatsPolicy> timer { m_stats, SymmetryPhase::Simplify };
+                mapSimplifiedAxes(p, epsilon, workspace);
+            }
+
+            if constexpr (StatsPolicy::enabled) {
+                // only growth of buffers is allocation
+                auto grown { workspace.getMemorySize() };
+                m_stats.addAllocated(grown > memory ? grown - memory : 0);
+            }
+            return workspace.m_compact;
+        }
+
+        /// <summary>
+        /// Build endpoints of compact axes
+        /// </summary>
+        /// <param name="nodes">nodes of polygon that axes were found for</param>
+        /// <param name="compact">compact axes</param>
+        /// <returns>vector with axes of symmetry</returns>
+        template <class Nodes>
+        static std::vector<Axis<RealOf<T>>> toAxes(const Nodes& nodes, const std::vector<CompactAxis>& compact) {
+            std::vector<Axis<RealOf<T>>> axes{};
+            toAxes(nodes, compact, axes);
+            return axes;
+        }
+
+        /// <summary>
+        /// Build endpoints of compact axes into vector, memory of vector is reused
+        /// </summary>
+        /// <param name="nodes">nodes of polygon that axes were found for</param>
+        /// <param name="compact">compact axes</param>
+        /// <param name="axes">output: axes of symmetry</param>
+        template <class Nodes>
+        static void toAxes(const Nodes& nodes, const std::vector<CompactAxis>& compact, std::vector<Axis<RealOf<T>>>& axes) {
+            axes.clear();
+            axes.reserve(compact.size());
+            for (const auto& axis : compact) {
+                axes.push_back(Axis<RealOf<T>>(EdgeAngleSequence<T>::getElementPoint(nodes, axis.first),
+                                               EdgeAngleSequence<T>::getElementPoint(nodes, axis.second)));
+            }
+        }
+
+        /// <summary>
+        /// Find full symmetry group: rotation order and axes of reflection. Rotations are found
+        /// by matching edge/angle sequence with itself by the same prefix function that matches it
+        /// with its reverse, so group costs about the same as axes. It uses edge/angle sequence
+        /// regardless of engine
+        /// </summary>
+        /// <param name="p">polygon</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>symmetry group</returns>
+        SymmetryGroup<RealOf<T>> findSymmetryGroup(const Polygon<T>& p, double epsilon) const {
+            return findSymmetryGroup(PolygonView<T>(p), epsilon);
+        }
+
+        /// <summary>
+        /// Find full symmetry group of polygon that is not owned
+        /// </summary>
+        /// <param name="p">view of polygon</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>symmetry group</returns>
+        SymmetryGroup<RealOf<T>> findSymmetryGroup(const PolygonView<T>& p, double epsilon) const {
+            SymmetryWorkspace<T> workspace{};
+            SymmetryGroup<RealOf<T>> group { 1, {} };
+            findSymmetryLinear(p, epsilon, workspace, &group.rotationOrder);
+            toAxes(p, workspace.m_compact, group.axes);
+            return group;
+        }
+
+        /// <summary>
+        /// Find axes of symmetry for many polygons on all workers of thread pool.
+        /// Polygons are split into chunks that idle workers steal from each other,
+        /// so few huge polygons do not leave other workers without work.
+        /// </summary>
+        /// <param name="polygons">polygons</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>axes of symmetry for every polygon in the same order</returns>
+        std::vector<std::vector<Axis<RealOf<T>>>> findSymmetryBatch(std::span<const Polygon<T>> polygons, double epsilon) const {
+            return findSymmetryBatchOf(polygons, epsilon);
+        }
+
+        /// <summary>
+        /// Find axes of symmetry for many polygons that are not owned, for example mapped from binary file
+        /// </summary>
+        /// <param name="polygons">views of polygons</param>
+        /// <param name="epsilon">presision</param>
+        /// <returns>axes of symmetry for every polygon in the same order</returns>
+        std::vector<std::vector<Axis<RealOf<T>>>> findSymmetryBatch(std::span<const PolygonView<T>> polygons, double epsilon) const {
+            return findSymmetryBatchOf(polygons, epsilon);
+        }
+
+        /// <summary>
+        /// Get thread pool for parallel work
+        /// </summary>
+        /// <returns>pool set by setThreadPool or default pool of process</returns>
+        ThreadPool& getThreadPool() const {
+            return m_pool != nullptr ? *m_pool : ThreadPool::getDefault();
+        }
+
+        /// <summary>
+        /// Set thread pool for parallel work
+        /// </summary>
+        /// <param name="pool">not owned pool, nullptr means default pool of process</param>
+        void setThreadPool(ThreadPool* pool) {
+            m_pool = pool;
+        }
+
+        /// <summary>
+        /// Set parallel evaluation of candidates of one polygon
+        /// </summary>
+        /// <param name="threadCount">max count of workers for one polygon, 0 means all workers of pool</param>
+        /// <param name="threshold">polygons with less count of nodes are evaluated serially</param>
+        void setParallelism(size_t threadCount, size_t threshold) {
+            m_threadCount = threadCount;
+            m_parallelThreshold = threshold;
+        }
+
+        /// <summary>
+        /// Get count of nodes from which polygons are simplified
+        /// </summary>
+        /// <returns>threshold of simplification, SIZE_MAX if it is disabled</returns>
+        size_t getSimplifyThreshold() const {
+            return m_simplifyThreshold;
+        }
+
+        /// <summary>
+        /// Set simplification before findSymmetry, polygons with at least kDefaultSimplifyThreshold
+        /// nodes are simplified by default. Duplicate nodes are
+        /// merged and collinear nodes are removed (PolygonSimplifier), so N is smaller and symmetry
+        /// hidden by extra nodes is found. It changes definition of symmetry: polygon is symmetric
+        /// when its simplified outline is symmetric, even if extra nodes are not mirrored.
+        /// Axes are mapped back to nodes and middles of edges of original polygon, axis whose end
+        /// is middle of run of edges without node or middle of edge there is dropped
+        /// </summary>
+        /// <param name="threshold">polygons with less count of nodes are not simplified,
+        /// SIZE_MAX disables simplification</param>
+        void setSimplifyThreshold(size_t threshold) {
+            m_simplifyThreshold = threshold;
+        }
+
+        /// <summary>
+        /// Enable check of invariant signature before evaluation of candidates.
+        /// It is used by Vectorized and MixedPrecision engines, Reference engine checks every candidate
+        /// and Linear engine does not evaluate candidates
+        /// </summary>
+        /// <param name="enabled">true if check is used</param>
+        void setPrefilter(bool enabled) {
+            m_prefilter = enabled;
+        }
+
+        /// <summary>
+        /// Set count of random nodes that are reflected across every candidate before
+        /// full comparison. It is used by Vectorized and MixedPrecision engines
+        /// </summary>
+        /// <param name="count">count of sampled nodes, 0 disables probe</param>
+        void setProbeCount(size_t count) {
+            m_probeCount = count;
+        }
+
+        /// <summary>
+        /// Get count of checked and rejected polygons by invariant signature. Only Vectorized and
+        /// MixedPrecision engines check signature, with Linear and Reference engines counts stay 0.
+        /// With SymmetryStats policy the same counts are in getStats()
+        /// </summary>
+        /// <returns>stats of prefilter</returns>
+        PrefilterStats getPrefilterStats() const {
+            return PrefilterStats{ m_prefilterChecked.get(), m_prefilterRejected.get() };
+        }
+
+        /// <summary>
+        /// Set stats of prefilter to 0
+        /// </summary>
+        void resetPrefilterStats() {
+            m_prefilterChecked.reset();
+            m_prefilterRejected.reset();
+        }
+
+        /// <summary>
+        /// Get time of phases and counters that are collected by findSymmetry
+        /// </summary>
+        /// <returns>stats of stats policy</returns>
+        const StatsPolicy& getStats() const {
+            return m_stats;
+        }
+
+        /// <summary>
+        /// Set collected stats to 0
+        /// </summary>
+        void resetStats() {
+            if constexpr (StatsPolicy::enabled) {
+                m_stats.reset();
+            }
+        }
+
+        /// <summary>
+        /// Get candidates in axis of symmetry. It only by angle point, and middle edge point
+        /// </summary>
+        /// <param name="p">Polygon</param>
+        /// <returns>vector of candidates</returns>
+        std::vector<Point2<T>> findCandidates(const Polygon<T>& p) const {
+            std::vector<Point2<T>> candidates{};
+            findCandidates(p, candidates);
+            return candidates;
+        }
+
+        /// <summary>
+        /// Get candidates in axis of symmetry into vector, memory of vector is reused
+        /// </summary>
+        /// <param name="p">Polygon</param>
+        /// <param name="candidates">output: nodes and then middles of edges</param>
+        void findCandidates(const Polygon<T>& p, std::vector<Point2<T>>& candidates) const {
+            const auto& nodes { p.getNodes() };
+            auto size { nodes.size() };
+            candidates.assign(nodes.begin(), nodes.end());
+            if (size == 0) {
+                return;
+            }
+
+            for (size_t i{}; i < size - 1; ++i) {
+                candidates.push_back((candidates[i] + candidates[i + 1]) / 2.0);
+            }
+                
+            candidates.push_back((candidates[0] + candidates[size - 1]) / 2.0);
+        }
+    private:
+        template <class Polygons>
+        std::vector<std::vector<Axis<RealOf<T>>>> findSymmetryBatchOf(const Polygons& polygons, double epsilon) const {
+            std::vector<std::vector<Axis<RealOf<T>>>> result(polygons.size());
+            auto& pool { getThreadPool() };
+            size_t grain { polygons.size() / (pool.getThreadCount() * 64) };
+
+            pool.parallelFor(polygons.size(), grain, [&](size_t i) {
+                result[i] = findSymmetry(polygons[i], epsilon);
+            });
+
+            return result;
+        }
+
+        /// <summary>
+        /// Find axes by matching of edge/angle sequence with its reverse.
+        /// Reflection maps sequence position q to (k - q) mod 2N, so every cyclic shift k of
+        /// reversed sequence that is equal to sequence gives an axis through elements k / 2
+        /// and k / 2 + N. All shifts are found by KMP in O(N).
+        /// Rotation maps position q to q + m, so rotations are cyclic shifts of sequence equal to itself.
+        /// Group with axes is dihedral and has as many rotations as axes, so sequence is
+        /// matched with itself only if no axis is confirmed by positions of nodes.
+        /// Errors of tokens that are equal with presision add up along polygon, so for floating T
+        /// matched axes and rotations are checked by positions of nodes (AxisVerifier): whole group
+        /// in O(N), and only if its bound fails every axis in O(N).
+        /// </summary>
+        /// <param name="nodes">nodes of polygon</param>
+        /// <param name="epsilon">presision</param>
+        /// <param name="workspace">reused buffers, output: compact axes of symmetry</param>
+        /// <param name="rotationOrder">output: count of rotations, nullptr if it is not needed</param>
+        template <class Nodes>
+        void findSymmetryLinear(const Nodes& nodes, double epsilon, SymmetryWorkspace<T>& workspace, size_t* rotationOrder = nullptr) const {
+            auto size { nodes.size() };
+            auto& axes { workspace.m_compact };
+            axes.clear();
+            if (size < 3) {
+                return;
+            }
+            if (size > UINT32_MAX / 2) {
+                throw std::runtime_error("Polygon is too large for compact axes");
+            }
+
+            PhaseTimer<StatsPolicy> timer { m_stats, SymmetryPhase::Sequence };
+            auto& sequence { workspace.m_sequence };
+            auto& reversed { workspace.m_reversed };
+            sequence.build(nodes);
+            sequence.getReversed(reversed);
+
+            timer.next(SymmetryPhase::Matching);
+            size_t comparisons{};
+            auto equal = [epsilon, &comparisons](const SequenceToken<T>& a, const SequenceToken<T>& b) {
+                if constexpr (StatsPolicy::enabled) {
+                    ++comparisons;
+                }
+                return a.isEqual(b, epsilon);
+            };
+            auto& prefix { workspace.m_prefix };
+            auto& shifts { workspace.m_shifts };
+            computePrefixFunction(sequence.getTokens(), equal, prefix);
+            findCyclicShifts(sequence.getTokens(), prefix, reversed, equal, shifts);
+
+            timer.next(SymmetryPhase::Pairing);
+            for (auto shift : shifts) {
+                auto first { EdgeAngleSequence<T>::getAxisPosition(size, shift) };
+                axes.push_back(CompactAxis{ static_cast<uint32_t>(first), static_cast<uint32_t>(first + size) });
+            }
+
+            // tokens are matched one by one, so their errors add up along polygon, axes and rotations are
+            // checked by positions of nodes. Integer tokens are exact and matched polygon is congruent
+            auto& verifier { workspace.m_verifier };
+            if constexpr (!std::is_integral_v<T>) {
+                timer.next(SymmetryPhase::Verification);
+                if (!axes.empty()) {
+                    verifier.build(nodes);
+                    comparisons += verifier.verifyAxes(axes, epsilon);
+                }
+            }
+
+            // rotations are matched whenever no axis is confirmed, tentative axes can all fail verification
+            auto& rotations { workspace.m_rotations };
+            rotations.clear();
+            if (rotationOrder != nullptr && axes.empty()) {
+                timer.next(SymmetryPhase::Matching);
+                findCyclicShifts(sequence.getTokens(), prefix, sequence.getTokens(), equal, rotations);
+                if constexpr (!std::is_integral_v<T>) {
+                    timer.next(SymmetryPhase::Verification);
+                    // verifier is already built for tentative axes
+                    if (shifts.empty()) {
+                        verifier.build(nodes);
+                    }
+                    comparisons += verifier.verifyRotations(rotations, epsilon);
+                }
+            }
+
+            if constexpr (StatsPolicy::enabled) {
+                // every shift of reversed sequence is candidate
+                m_stats.addCandidates(2 * size, 2 * size, axes.size());
+                m_stats.addComparisons(comparisons);
+            }
+            if (rotationOrder != nullptr) {
+                // group with axes is dihedral and has as many rotations as axes
+                *rotationOrder = std::max<size_t>(axes.empty() ? rotations.size() : axes.size(), 1);
+            }
+        }
+
+        /// <summary>
+        /// Find axes by reflect polygon across every candidate and compare with source.
+        /// Reference engine keeps old algorithm without prefilter, probe, index and buckets,
+        /// so it stays independent check of them
+        /// </summary>
+        /// <param name="nodes">nodes of polygon</param>
+        /// <param name="epsilon">presision</param>
+        /// <param name="workspace">reused buffers, output: compact axes of symmetry</param>
+        void findSymmetryCandidates(const PolygonView<T>& nodes, double epsilon, SymmetryWorkspace<T>& workspace) const {
+            workspace.m_compact.clear();
+            if (nodes.size() > UINT32_MAX / 2) {
+                throw std::runtime_error("Polygon is too large for compact axes");
+            }
+
             //get center and move it in (0, 0)
+            PhaseTimer<StatsPolicy> timer { m_stats, SymmetryPhase::Centering };
+            auto& p { workspace.m_polygon };
+            p.assign(nodes);
             auto center { p.getCenter() };
             p.translate(center);
 
+            // Reject polygon without pairs of equal radii, edges or turns
+            timer.next(SymmetryPhase::Prefilter);
+            bool reference { m_engine == SymmetryEngine::Reference };
+            if (m_prefilter && !reference) {
+                m_prefilterChecked.add();
+                if (!workspace.m_signature.maybeSymmetric(p.getNodes(), epsilon)) {
+                    m_prefilterRejected.add();
+                    m_stats.addPrefilter(1, 1);
+                    m_stats.addEarlyExits(1);
+                    return;
+                }
+                m_stats.addPrefilter(1, 0);
+            }
+
             // Get candidates
-            auto candidates { findCandidates(p) };
-            Polygon<T> r { p };
+            timer.next(SymmetryPhase::Candidates);
+            auto& candidates { workspace.m_candidates };
+            auto& index { workspace.m_index };
+            auto& probe { workspace.m_probe };
+            auto& result { workspace.m_accepted };
+            findCandidates(p, candidates);
+            if (!reference) {
+                index.build(p.getNodes(), epsilon);
+                probe.build(p.getNodes(), index, m_probeCount);
+            }
+            result.clear();
+
+            timer.next(SymmetryPhase::Evaluation);
+            if (m_engine == SymmetryEngine::Vectorized || m_engine == SymmetryEngine::MixedPrecision) {
+                auto& targets { workspace.m_targets };
+                targets.build(p.getNodes(), index);
+                if (m_engine == SymmetryEngine::MixedPrecision) {
+                    targets.buildScreen(epsilon);
+                }
+                evaluateInSlices(p.getNodes().size(), candidates.size(), workspace,
+                    [&](size_t, size_t begin, size_t end, std::vector<size_t>& accepted) {
+                        evaluateCandidatesVectorized(targets, probe, candidates, begin, end, epsilon, accepted);
+                    });
+            } else {
+                evaluateInSlices(p.getNodes().size(), candidates.size(), workspace,
+                    [&](size_t slice, size_t begin, size_t end, std::vector<size_t>& accepted) {
+                        evaluateCandidates(p, workspace.m_rotated[slice], candidates, begin, end, epsilon, accepted);
+                    });
+            }
+
+            // merge selected candidates into axes
+            timer.next(SymmetryPhase::Pairing);
+            if constexpr (StatsPolicy::enabled) {
+                m_stats.addCandidates(candidates.size(), candidates.size(), result.size());
+            }
+            
+            if (reference) {
+                getAxesPairwise(candidates, result, p.getNodes().size(), epsilon, workspace);
+            } else {
+                getAxes(candidates, result, p.getNodes().size(), epsilon, workspace);
+            }
+        }
+
+        /// <summary>
+        /// Map compact axes of simplified polygon to positions of original polygon, axes
+        /// whose ends are not original elements are removed
+        /// </summary>
+        /// <param name="p">original polygon</param>
+        /// <param name="epsilon">presision</param>
+        /// <param name="workspace">simplified polygon, compact axes of simplified polygon, output: mapped axes</param>
+        void mapSimplifiedAxes(const PolygonView<T>& p, double epsilon, SymmetryWorkspace<T>& workspace) const {
+            const auto& simplifier { workspace.m_simplifier };
+            auto& axes { workspace.m_compact };
+            size_t kept{};
+            for (const auto& axis : axes) {
+                auto first { simplifier.mapPosition(p, axis.first, epsilon) };
+                auto second { simplifier.mapPosition(p, axis.second, epsilon) };
+                if (first != SIZE_MAX && second != SIZE_MAX) {
+                    axes[kept++] = CompactAxis{ static_cast<uint32_t>(first), static_cast<uint32_t>(second) };
+                }
+            }
+            axes.resize(kept);
+        }
+
+        /// <summary>
+        /// Evaluate candidates serially or split them into slices for workers of pool
+        /// </summary>
+        /// <param name="size">count of nodes of polygon</param>
+        /// <param name="count">count of candidates</param>
+        /// <param name="workspace">reused buffers, output: indices of accepted candidates in increasing order</param>
+        /// <param name="evaluate">function that evaluates range of candidates in slice</param>
+        template <class Evaluate>
+        void evaluateInSlices(size_t size, size_t count, SymmetryWorkspace<T>& workspace, Evaluate evaluate) const {
+            auto& result { workspace.m_accepted };
+            if (size < m_parallelThreshold) {
+                prepareSlices(workspace, 1);
+                evaluate(0, 0, count, result);
+                return;
+            }
+
+            // every worker takes own slice of candidates
+            auto& pool { getThreadPool() };
+            size_t slices { std::min(m_threadCount == 0 ? pool.getThreadCount() : m_threadCount, count) };
+            prepareSlices(workspace, slices);
+            auto& accepted { workspace.m_slices };
+
+            pool.parallelFor(slices, 1, [&](size_t i) {
+                evaluate(i, count * i / slices, count * (i + 1) / slices, accepted[i]);
+            });
+
+            for (size_t i{}; i < slices; ++i) {
+                result.insert(result.end(), accepted[i].begin(), accepted[i].end());
+            }
+        }
+
+        /// <summary>
+        /// Prepare buffers of slices: accepted candidates and rotated copies of polygon for Reference engine
+        /// </summary>
+        /// <param name="workspace">reused buffers</param>
+        /// <param name="slices">count of slices</param>
+        void prepareSlices(SymmetryWorkspace<T>& workspace, size_t slices) const {
+            if (workspace.m_slices.size() < slices) {
+                workspace.m_slices.resize(slices);
+            }
+            for (size_t i{}; i < slices; ++i) {
+                workspace.m_slices[i].clear();
+            }
+            if (m_engine == SymmetryEngine::Reference) {
+                if (workspace.m_rotated.size() < slices) {
+                    workspace.m_rotated.resize(slices);
+                }
+                for (size_t i{}; i < slices; ++i) {
+                    workspace.m_rotated[i].assign(workspace.m_polygon.getNodes());
+                }
+            }
+        }
 
-            //Try rotate polygon by pi and axis as candidate(this axis end with point and start with (0,0))
-            std::vector<Point2<T>> result{};
-            for(const Point2<T>& candidate : candidates) {
-                auto direction { candidate.getNormalized() };
+        /// <summary>
+        /// Reflect polygon across every candidate by SIMD kernel
+        /// </summary>
+        /// <param name="targets">prepared nodes of polygon with center in (0, 0)</param>
+        /// <param name="probe">fast rejection of candidates</param>
+        /// <param name="candidates">all candidates</param>
+        /// <param name="begin">index of first evaluated candidate</param>
+        /// <param name="end">index after last evaluated candidate</param>
+        /// <param name="epsilon">presision</param>
+        /// <param name="result">output: indices of accepted candidates</param>
+        void evaluateCandidatesVectorized(const ReflectionTargets<T>& targets, const CandidateProbe<T>& probe,
+                                          const std::vector<Point2<T>>& candidates,
+                                          size_t begin, size_t end, double epsilon, std::vector<size_t>& result) const {
+            size_t rejected{};
+            for (size_t i{ begin }; i < end; ++i) {
+                // candidate in center gives no direction, it is paired with other end of axis in getAxes
+                if (candidates[i].x == 0 && candidates[i].y == 0) {
+                    ++rejected;
+                    continue;
+                }
+                auto direction { candidates[i].getNormalized() };
+                if (!probe.mayBeAxis(direction)) {
+                    ++rejected;
+                } else if (targets.isAxis(direction, epsilon)) {
+                    result.push_back(i);
+                }
+            }
+            addEvaluationStats(probe, targets.getNodes().size(), end - begin, rejected);
+        }
+
+        /// <summary>
+        /// Try rotate polygon by pi and axis as candidate(this axis end with point and start with (0,0))
+        /// </summary>
+        /// <param name="p">polygon with center in (0, 0)</param>
+        /// <param name="r">copy of p that is rotated</param>
+        /// <param name="candidates">all candidates</param>
+        /// <param name="begin">index of first evaluated candidate</param>
+        /// <param name="end">index after last evaluated candidate</param>
+        /// <param name="epsilon">presision</param>
+        /// <param name="result">output: indices of accepted candidates</param>
+        void evaluateCandidates(const Polygon<T>& p, Polygon<T>& r, const std::vector<Point2<T>>& candidates,
+                                size_t begin, size_t end, double epsilon, std::vector<size_t>& result) const {
+            for (size_t i{ begin }; i < end; ++i) {
+                // candidate in center gives no direction, it is paired with other end of axis in getAxesPairwise
+                if (candidates[i].x == 0 && candidates[i].y == 0) {
+                    continue;
+                }
+                auto direction { candidates[i].getNormalized() };
                 
                 r.rotate(std::acos(-1), direction);
                 
                 if(p.isEqual(r, epsilon)) {
-                    // get selected candidate without translate
-                    result.push_back(candidate + center);
+                    result.push_back(i);
                 }
 
                 // return rotated polygon in start position 
                 r.rotate(std::acos(-1), direction);
             }
-            
-            return getAxes(center, result, epsilon);
+            if constexpr (StatsPolicy::enabled) {
+                m_stats.addComparisons((end - begin) * p.getNodes().size());
+            }
         }
-    private:
+
         /// <summary>
-        /// Get all axes of symmetry
+        /// Add comparisons and early exits of evaluated range of candidates. Probe of candidate
+        /// takes count of samples comparisons, full check is counted as comparison of all nodes
         /// </summary>
-        /// <param name="center">center of polygon</param>
-        /// <param name="points">founded candidates</param>
-        /// <returns>vector with axes of symmetry</returns>
-        std::vector<Axis<T>> getAxes(Point2<T>& center, std::vector<Point2<T>>& points, double epsilon) {
-            std::vector<Axis<T>> candidates{};
-            auto size { points.size() };
-
-            for (int i{}; i < size; ++i) {
-                for(int j { i + 1 }; j < size; ++j) {
-                    auto dx { (center.x - points[i].x) }, dy{ (center.y - points[i].y) },
-                         tx { (points[j].x - points[i].x) }, ty{ (points[j].y - points[i].y) };
+        /// <param name="probe">used probe</param>
+        /// <param name="size">count of nodes</param>
+        /// <param name="count">count of evaluated candidates</param>
+        /// <param name="rejected">count of candidates that are rejected by probe</param>
+        void addEvaluationStats(const CandidateProbe<T>& probe, size_t size, size_t count, size_t rejected) const {
+            if constexpr (StatsPolicy::enabled) {
+                m_stats.addComparisons(count * probe.size() + (count - rejected) * size);
+                m_stats.addEarlyExits(rejected);
+            }
+        }
+
+        /// <summary>
+        /// Merge accepted candidates into axes of symmetry. Line through center and candidate is
+        /// given by angle in [0, pi), sorted angles that are closer than tolerance are one axis.
+        /// Candidate at radius r whose nodes differ by epsilon has angle error about epsilon / r,
+        /// so tolerance of two neighbours is sum of their errors. Different axes of polygon with
+        /// N nodes differ at least by pi / N, so tolerance is clamped to pi / (4N). Axis is stored
+        /// by two extreme candidates of its bucket, so every axis is found once. Candidate that is
+        /// left alone (for example near center, where clamp is smaller than its error) is merged
+        /// into nearest bucket instead of being lost. If polygon has element in center, this element lies
+        /// on every axis and is not evaluated, so alone candidate is axis with it.
+        /// Takes O(K log K) for K accepted candidates
+        /// </summary>
+        /// <param name="candidates">all candidates of polygon with center in (0, 0)</param>
+        /// <param name="accepted">indices of accepted candidates</param>
+        /// <param name="size">count of nodes</param>
+        /// <param name="epsilon">presision</param>
+        /// <param name="workspace">reused buffers, output: compact axes of symmetry</param>
+        void getAxes(const std::vector<Point2<T>>& candidates, const std::vector<size_t>& accepted,
+                     size_t size, double epsilon, SymmetryWorkspace<T>& workspace) const {
+            auto& axes { workspace.m_compact };
+            axes.clear();
+            auto count { accepted.size() };
+            auto center { findCenterCandidate(candidates) };
+            if (count == 0 || (count == 1 && center == SIZE_MAX)) {
+                return;
+            }
+
+            auto& angles { workspace.m_angles };
+            angles.resize(count);
+            for (size_t i{}; i < count; ++i) {
+                const auto& point { candidates[accepted[i]] };
+                T angle { std::atan2(point.y, point.x) };
+                angles[i] = { angle < 0 ? angle + std::numbers::pi_v<T> : angle, accepted[i] };
+            }
+            std::sort(angles.begin(), angles.end());
+
+            double maxTolerance { std::numbers::pi / (4.0 * size) };
+            auto error = [&](size_t i) {
+                const auto& point { candidates[angles[i].second] };
+                double radius { std::hypot(double(point.x), double(point.y)) };
+                return radius > 0 ? std::max(epsilon, 1e-12) / radius : maxTolerance;
+            };
+            auto isNear = [&](size_t i) {
+                // angle between candidate i - 1 and i, candidate 0 follows last candidate through pi
+                auto previous { i == 0 ? count - 1 : i - 1 };
+                double gap { i == 0 ? angles[0].first + std::numbers::pi_v<T> - angles[count - 1].first
+                                    : angles[i].first - angles[i - 1].first };
+                return gap <= std::min(maxTolerance, error(previous) + error(i));
+            };
+
+            // start from first gap, so bucket that crosses pi is not split
+            size_t start{};
+            while (start < count && isNear(start)) {
+                ++start;
+            }
+            if (start == count) {
+                start = 0;
+            }
+
+            // bucket is range of candidates without gaps, axis goes through extreme candidates
+            auto& buckets { workspace.m_buckets };
+            buckets.clear();
+            size_t merged{};
+            for (size_t k{}; k < count;) {
+                AngleBucket<T> bucket { k, k + 1, angles[(start + k) % count].first };
+                for (++k; k < count && isNear((start + k) % count); ++k) {
+                    bucket.end = k + 1;
+                }
+                merged += bucket.end - bucket.begin > 1 ? 1 : 0;
+                buckets.push_back(bucket);
+            }
+
+            auto distance = [](double a, double b) {
+                double d { std::fabs(a - b) };
+                return std::min(d, std::numbers::pi - d);
+            };
+            auto bucketCount { buckets.size() };
+            for (size_t b{}; b < bucketCount && merged > 0 && center == SIZE_MAX; ++b) {
+                auto& bucket { buckets[b] };
+                if (bucket.end - bucket.begin > 1) {
+                    continue;
+                }
+                // nearest buckets with several candidates before and after single candidate
+                size_t previous { (b + bucketCount - 1) % bucketCount }, next { (b + 1) % bucketCount };
+                while (buckets[previous].end - buckets[previous].begin < 2) {
+                    previous = (previous + bucketCount - 1) % bucketCount;
+                }
+                while (buckets[next].end - buckets[next].begin < 2) {
+                    next = (next + 1) % bucketCount;
+                }
+                double toPrevious { distance(bucket.angle, angles[(start + buckets[previous].end - 1) % count].first) };
+                double toNext { distance(bucket.angle, buckets[next].angle) };
+                bucket.target = toPrevious <= toNext ? previous : next;
+            }
+
+            for (auto& bucket : buckets) {
+                if (bucket.end - bucket.begin < 2) {
+                    continue;
+                }
+                bucket.direction = Point2<T>(std::cos(bucket.angle), std::sin(bucket.angle));
+                for (auto k { bucket.begin }; k < bucket.end; ++k) {
+                    bucket.add(candidates, angles[(start + k) % count].second);
+                }
+            }
+            for (auto& bucket : buckets) {
+                if (bucket.end - bucket.begin < 2 && bucket.target != SIZE_MAX) {
+                    buckets[bucket.target].add(candidates, angles[(start + bucket.begin) % count].second);
+                }
+            }
+            for (const auto& bucket : buckets) {
+                if (bucket.end - bucket.begin > 1 && bucket.minIndex != bucket.maxIndex) {
+                    axes.push_back(CompactAxis{ getPosition(bucket.minIndex, size), getPosition(bucket.maxIndex, size) });
+                } else if (bucket.end - bucket.begin == 1 && center != SIZE_MAX) {
+                    auto other { angles[(start + bucket.begin) % count].second };
+                    axes.push_back(CompactAxis{ getPosition(std::min(center, other), size),
+                                                getPosition(std::max(center, other), size) });
+                }
+            }
+        }
+
+        /// <summary>
+        /// Merge accepted candidates into axes like old algorithm: every pair of accepted candidates
+        /// that lies on one line with center is axis. Candidate without pair is axis with element in center
+        /// if polygon has it. Takes O(K^2) for K accepted candidates
+        /// </summary>
+        /// <param name="candidates">all candidates of polygon with center in (0, 0)</param>
+        /// <param name="accepted">indices of accepted candidates</param>
+        /// <param name="size">count of nodes</param>
+        /// <param name="epsilon">presision</param>
+        /// <param name="workspace">reused buffers, output: compact axes of symmetry</param>
+        void getAxesPairwise(const std::vector<Point2<T>>& candidates, const std::vector<size_t>& accepted,
+                             size_t size, double epsilon, SymmetryWorkspace<T>& workspace) const {
+            auto& axes { workspace.m_compact };
+            axes.clear();
+            auto center { findCenterCandidate(candidates) };
+            for (size_t i{}; i < accepted.size(); ++i) {
+                bool paired{};
+                for (size_t j{}; j < accepted.size(); ++j) {
+                    const auto& a { candidates[accepted[i]] };
+                    const auto& b { candidates[accepted[j]] };
                     // If is line
-                    if(abs(dx * ty - dy * tx) < epsilon) {
-                        candidates.push_back(Axis<T>(points[i], points[j]));
+                    if (j != i && std::abs(a.x * b.y - a.y * b.x) < epsilon) {
+                        paired = true;
+                        if (j > i) {
+                            axes.push_back(CompactAxis{ getPosition(accepted[i], size), getPosition(accepted[j], size) });
+                        }
                     }
                 }
+                if (!paired && center != SIZE_MAX) {
+                    axes.push_back(CompactAxis{ getPosition(std::min(center, accepted[i]), size),
+                                                getPosition(std::max(center, accepted[i]), size) });
+                }
             }
-            
-            return candidates;
         }
 
         /// <summary>
-        /// Get candidates in axis of symmetry. It only by angle point, and middle edge point
+        /// Find candidate that lies exactly in center, it lies on every line through center
         /// </summary>
-        /// <param name="p">Polygon</param>
-        /// <returns>vector of candidates</returns>
-        std::vector<Point2<T>> findCandidates(const Polygon<T>& p) {
-
-            std::vector<Point2<T>> candidates(p.getNodes());
-            auto size{ candidates.size() };
-
-            for (int i{}; i < size - 1; ++i) {
-                candidates.push_back((candidates[i] + candidates[i + 1]) / 2.0);
+        /// <param name="candidates">all candidates of polygon with center in (0, 0)</param>
+        /// <returns>index of candidate or SIZE_MAX</returns>
+        static size_t findCenterCandidate(const std::vector<Point2<T>>& candidates) {
+            for (size_t i{}; i < candidates.size(); ++i) {
+                if (candidates[i].x == 0 && candidates[i].y == 0) {
+                    return i;
+                }
             }
-                
-            candidates.push_back((candidates[0] + candidates[size - 1]) / 2.0);
+            return SIZE_MAX;
+        }
 
-            return candidates;
+        /// <summary>
+        /// Get position of candidate in edge/angle sequence
+        /// </summary>
+        /// <param name="candidate">index of candidate: nodes and then middles of edges</param>
+        /// <param name="size">count of nodes</param>
+        /// <returns>position of element</returns>
+        static uint32_t getPosition(size_t candidate, size_t size) {
+            return static_cast<uint32_t>(candidate < size ? 2 * candidate : 2 * (candidate - size) + 1);
         }
+
+        SymmetryEngine m_engine;
+        ThreadPool* m_pool{};
+        size_t m_threadCount{};
+        size_t m_parallelThreshold{ 256 };
+        size_t m_simplifyThreshold{ kDefaultSimplifyThreshold };
+        bool m_prefilter{ true };
+        size_t m_probeCount{ 8 };
+        mutable Counter m_prefilterChecked;
+        mutable Counter m_prefilterRejected;
+        [[no_unique_address]] mutable StatsPolicy m_stats;
 };
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Axis.hpp"
+#include <cstddef>
+#include <vector>
+
+/// <summary>
+/// Symmetry group of polygon: cyclic group of rotations around center of polygon
+/// and axes of reflection. Polygon with axes has dihedral group, count of axes is
+/// equal to rotation order. Polygon without axes (for example pinwheel) has only rotations.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+struct SymmetryGroup {
+    /// <summary>
+    /// Count of rotations that map polygon to itself, rotation by 2 * pi / order generates them.
+    /// Order 1 means that polygon has only identity rotation
+    /// </summary>
+    size_t rotationOrder;
+    /// <summary>
+    /// Axes of reflection
+    /// </summary>
+    std::vector<Axis<T>> axes;
+
+    /// <summary>
+    /// Get count of elements of group
+    /// </summary>
+    /// <returns>rotations and reflections</returns>
+    size_t getOrder() const {
+        return rotationOrder + axes.size();
+    }
+
+    /// <summary>
+    /// Check that group has reflections
+    /// </summary>
+    /// <returns>true if group is dihedral else false</returns>
+    bool isDihedral() const {
+        return !axes.empty();
+    }
+};
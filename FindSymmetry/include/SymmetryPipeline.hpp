@@ -0,0 +1,247 @@
+#pragma once
+
+#include "Axis.hpp"
+#include "AxisWriter.hpp"
+#include "Polygon.hpp"
+#include "PolygonView.hpp"
+#include "PolygonFile.hpp"
+#include "PolygonReader.hpp"
+#include "SpscQueue.hpp"
+#include "SymmetryFinder.hpp"
+#include "SymmetryWorkspace.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Polygon that goes through stages of pipeline
+/// </summary>
+struct PipelineItem {
+    std::string label;
+    Polygon<double> polygon;
+    Point2<double> center;
+    std::vector<Axis<double>> axes;
+};
+
+/// <summary>
+/// Batch of files processed by four stages that run at once and are connected by bounded
+/// lock-free single producer single consumer queues:
+/// read and parse chunks of files, center polygons, find axes on several workers, format and write.
+/// Center stage gives polygons to detect workers by round robin and write stage takes results
+/// by the same round robin, so output is in input order without reordering. Full queue blocks
+/// its producer, so memory is bounded while disk, cores and output are busy at once.
+/// </summary>
+class SymmetryPipeline {
+    public:
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="workerCount">count of detect workers, 0 means count of hardware threads</param>
+        /// <param name="queueCapacity">capacity of every queue</param>
+        /// <param name="chunkSize">size of text that is parsed at once</param>
+        explicit SymmetryPipeline(size_t workerCount = 0, size_t queueCapacity = 256, size_t chunkSize = 1 << 20)
+            : m_workerCount(workerCount != 0 ? workerCount : std::max(1u, std::thread::hardware_concurrency())),
+              m_queueCapacity(std::max<size_t>(queueCapacity, 2)), m_chunkSize(std::max<size_t>(chunkSize, 1)) {}
+
+        /// <summary>
+        /// Get count of detect workers
+        /// </summary>
+        /// <returns>count of workers</returns>
+        size_t getWorkerCount() const {
+            return m_workerCount;
+        }
+
+        /// <summary>
+        /// Find axes of all polygons of text and binary files and write them in order of files.
+        /// Every polygon is written as "label:" line and its axes or "non-symmetric",
+        /// label is filename with index of polygon in file
+        /// </summary>
+        /// <param name="filenames">files with polygons</param>
+        /// <param name="out">output stream, it is written by large blocks</param>
+        /// <param name="epsilon">presision</param>
+        /// <param name="format">format of output</param>
+        /// <returns>count of polygons</returns>
+        size_t run(const std::vector<std::string>& filenames, std::ostream& out, double epsilon = 1e-8, AxisFormat format = AxisFormat::Text) {
+            SpscQueue<PipelineItem> parsed { m_queueCapacity };
+            std::vector<std::unique_ptr<SpscQueue<PipelineItem>>> centered{}, detected{};
+            for (size_t i{}; i < m_workerCount; ++i) {
+                centered.push_back(std::make_unique<SpscQueue<PipelineItem>>(m_queueCapacity));
+                detected.push_back(std::make_unique<SpscQueue<PipelineItem>>(m_queueCapacity));
+            }
+
+            // failed stage closes all queues, so other stages stop
+            std::exception_ptr error{};
+            std::mutex errorMutex{};
+            auto fail = [&] {
+                {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                parsed.close();
+                for (size_t i{}; i < m_workerCount; ++i) {
+                    centered[i]->close();
+                    detected[i]->close();
+                }
+            };
+
+            std::vector<std::thread> threads{};
+            threads.emplace_back([&] {
+                try {
+                    read(filenames, parsed);
+                } catch (...) {
+                    fail();
+                }
+                parsed.close();
+            });
+            threads.emplace_back([&] {
+                try {
+                    center(parsed, centered);
+                } catch (...) {
+                    fail();
+                }
+                for (auto& queue : centered) {
+                    queue->close();
+                }
+            });
+            for (size_t i{}; i < m_workerCount; ++i) {
+                threads.emplace_back([&, i] {
+                    try {
+                        detect(*centered[i], *detected[i], epsilon);
+                    } catch (...) {
+                        fail();
+                    }
+                    detected[i]->close();
+                });
+            }
+
+            size_t count{};
+            try {
+                count = write(detected, out, format);
+            } catch (...) {
+                fail();
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return count;
+        }
+    private:
+        /// <summary>
+        /// Stage 1: read files, text is parsed by chunks that end on boundary of polygons
+        /// </summary>
+        void read(const std::vector<std::string>& filenames, SpscQueue<PipelineItem>& output) const {
+            for (const auto& filename : filenames) {
+                size_t index{};
+                auto emit = [&](Polygon<double> polygon) {
+                    return output.push(PipelineItem{ filename + "[" + std::to_string(index++) + "]", std::move(polygon), {}, {} });
+                };
+
+                if (PolygonFile::isPolygonFile(filename)) {
+                    PolygonFile file { filename };
+                    for (size_t i{}; i < file.size(); ++i) {
+                        if (!emit(file[i].toPolygon())) {
+                            return;
+                        }
+                    }
+                    continue;
+                }
+
+                MappedFile file { filename };
+                const char* begin { file.data() };
+                const char* end { file.data() + file.size() };
+                while (begin < end) {
+                    const char* chunkEnd { findChunkEnd(begin, end) };
+                    for (auto& polygon : parsePolygons<double>(begin, chunkEnd)) {
+                        if (!emit(std::move(polygon))) {
+                            return;
+                        }
+                    }
+                    begin = chunkEnd;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Find end of chunk: start of first blank or header line after chunk size
+        /// </summary>
+        const char* findChunkEnd(const char* begin, const char* end) const {
+            if (static_cast<size_t>(end - begin) <= m_chunkSize) {
+                return end;
+            }
+            for (const char* line { std::find(begin + m_chunkSize, end, '\n') }; line < end; line = std::find(line + 1, end, '\n')) {
+                const char* c { line + 1 };
+                while (c < end && (*c == ' ' || *c == '\t' || *c == '\r' || *c == ',')) {
+                    ++c;
+                }
+                if (c == end || *c == '\n' || *c == '#') {
+                    return line + 1;
+                }
+            }
+            return end;
+        }
+
+        /// <summary>
+        /// Stage 2: move center of every polygon in (0, 0), so tokens of polygons that are far
+        /// from origin do not lose presision. Polygons go to detect workers by round robin
+        /// </summary>
+        void center(SpscQueue<PipelineItem>& input, std::vector<std::unique_ptr<SpscQueue<PipelineItem>>>& output) const {
+            PipelineItem item{};
+            for (size_t i{}; input.pop(item); ++i) {
+                if (!item.polygon.getNodes().empty()) {
+                    item.center = item.polygon.getCenter();
+                    item.polygon.translate(item.center);
+                }
+                if (!output[i % output.size()]->push(std::move(item))) {
+                    return;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Stage 3: find axes, every worker reuses own workspace
+        /// </summary>
+        void detect(SpscQueue<PipelineItem>& input, SpscQueue<PipelineItem>& output, double epsilon) const {
+            SymmetryWorkspace<double> workspace{};
+            PipelineItem item{};
+            while (input.pop(item)) {
+                const auto& axes { m_finder.findSymmetry(PolygonView<double>(item.polygon), epsilon, workspace) };
+                item.axes.clear();
+                for (const auto& axis : axes) {
+                    item.axes.push_back(Axis<double>(axis.getStart() + item.center, axis.getEnd() + item.center));
+                }
+                if (!output.push(std::move(item))) {
+                    return;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Stage 4: take results by the same round robin as center stage and write them by large blocks
+        /// </summary>
+        size_t write(std::vector<std::unique_ptr<SpscQueue<PipelineItem>>>& input, std::ostream& out, AxisFormat format) const {
+            AxisWriter writer { out, format };
+            PipelineItem item{};
+            size_t count{};
+            for (; input[count % input.size()]->pop(item); ++count) {
+                writer.write(item.label, item.axes);
+            }
+            writer.flush();
+            return count;
+        }
+
+        size_t m_workerCount;
+        size_t m_queueCapacity;
+        size_t m_chunkSize;
+        SymmetryFinder<double> m_finder{};
+};
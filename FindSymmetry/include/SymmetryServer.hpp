@@ -0,0 +1,461 @@
+#pragma once
+
+#ifndef _WIN32
+
+#include "Axis.hpp"
+#include "PolygonView.hpp"
+#include "SymmetryFinder.hpp"
+#include "SymmetryWorkspace.hpp"
+#include "ThreadPool.hpp"
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/// <summary>
+/// Protocol of server. Every message is a frame: uint32 length of payload and payload,
+/// all numbers are in byte order of host, so server is for local clients only.
+/// Request payload: uint64 id, double epsilon, then x and y of every node.
+/// Response payload: uint64 id, uint32 status, uint32 count, then for status Ok count axes
+/// as x and y of both ends, for status Error count bytes of message.
+/// </summary>
+namespace SymmetryProtocol {
+    constexpr uint32_t maxFrameSize { 1u << 30 };
+    constexpr uint32_t statusOk { 0 };
+    constexpr uint32_t statusError { 1 };
+
+    /// <summary>
+    /// Read exactly size bytes
+    /// </summary>
+    /// <param name="fd">file descriptor</param>
+    /// <param name="data">output buffer</param>
+    /// <param name="size">count of bytes</param>
+    /// <returns>false if stream is closed before first byte else true</returns>
+    inline bool readFully(int fd, void* data, size_t size) {
+        auto* bytes { static_cast<char*>(data) };
+        for (size_t done{}; done < size;) {
+            auto count { ::read(fd, bytes + done, size - done) };
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            if (count < 0) {
+                throw std::runtime_error(std::string("Read failed: ") + std::strerror(errno));
+            }
+            if (count == 0) {
+                if (done == 0) {
+                    return false;
+                }
+                throw std::runtime_error("Stream is closed inside frame");
+            }
+            done += static_cast<size_t>(count);
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// Write exactly size bytes
+    /// </summary>
+    /// <param name="fd">file descriptor</param>
+    /// <param name="data">written bytes</param>
+    /// <param name="size">count of bytes</param>
+    inline void writeFully(int fd, const void* data, size_t size) {
+        const auto* bytes { static_cast<const char*>(data) };
+        for (size_t done{}; done < size;) {
+            auto count { ::write(fd, bytes + done, size - done) };
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            if (count < 0) {
+                throw std::runtime_error(std::string("Write failed: ") + std::strerror(errno));
+            }
+            done += static_cast<size_t>(count);
+        }
+    }
+
+    /// <summary>
+    /// Append value to frame
+    /// </summary>
+    template <class Value>
+    void append(std::vector<char>& frame, const Value& value) {
+        auto size { frame.size() };
+        frame.resize(size + sizeof(Value));
+        std::memcpy(frame.data() + size, &value, sizeof(Value));
+    }
+
+    /// <summary>
+    /// Write length of payload into first 4 bytes of frame
+    /// </summary>
+    inline void finishFrame(std::vector<char>& frame) {
+        uint32_t length { static_cast<uint32_t>(frame.size() - sizeof(uint32_t)) };
+        std::memcpy(frame.data(), &length, sizeof(length));
+    }
+
+    /// <summary>
+    /// Get address of Unix domain socket
+    /// </summary>
+    /// <param name="path">path of socket</param>
+    /// <returns>address</returns>
+    inline sockaddr_un getAddress(const std::string& path) {
+        sockaddr_un address{};
+        if (path.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("Path of socket is too long");
+        }
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        return address;
+    }
+
+    /// <summary>
+    /// Create Unix domain socket
+    /// </summary>
+    /// <returns>file descriptor of socket</returns>
+    inline int createSocket() {
+        int fd { ::socket(AF_UNIX, SOCK_STREAM, 0) };
+        if (fd < 0) {
+            throw std::runtime_error(std::string("Socket can not be created: ") + std::strerror(errno));
+        }
+        return fd;
+    }
+
+    /// <summary>
+    /// Read frame
+    /// </summary>
+    /// <param name="fd">file descriptor</param>
+    /// <param name="payload">output: payload of frame</param>
+    /// <returns>false if stream is closed else true</returns>
+    inline bool readFrame(int fd, std::vector<char>& payload) {
+        uint32_t length{};
+        if (!readFully(fd, &length, sizeof(length))) {
+            return false;
+        }
+        if (length > maxFrameSize) {
+            throw std::runtime_error("Frame is too large");
+        }
+        payload.resize(length);
+        if (length > 0 && !readFully(fd, payload.data(), length)) {
+            throw std::runtime_error("Stream is closed inside frame");
+        }
+        return true;
+    }
+}
+
+/// <summary>
+/// Result of one request
+/// </summary>
+struct SymmetryResponse {
+    uint64_t id;
+    bool ok;
+    std::vector<Axis<double>> axes;
+    std::string error;
+};
+
+/// <summary>
+/// Long-running server that finds axes of symmetry for stream of length-prefixed requests
+/// from stdin/stdout or from clients of Unix domain socket. Requests are pipelined: reader
+/// submits every polygon to thread pool and reads next one while at most maxInFlight
+/// polygons are processed, responses are written as they finish, so they can be out of order
+/// and are matched by id.
+/// </summary>
+class SymmetryServer {
+    public:
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="maxInFlight">max count of requests that are processed at once, 0 means two per worker</param>
+        /// <param name="pool">not owned pool, nullptr means default pool of process</param>
+        explicit SymmetryServer(size_t maxInFlight = 0, ThreadPool* pool = nullptr)
+            : m_pool(pool != nullptr ? *pool : ThreadPool::getDefault()),
+              m_maxInFlight(maxInFlight != 0 ? maxInFlight : 2 * m_pool.getThreadCount()) {
+            m_finder.setThreadPool(&m_pool);
+        }
+
+        /// <summary>
+        /// Get max count of requests that are processed at once
+        /// </summary>
+        /// <returns>count of requests</returns>
+        size_t getMaxInFlight() const {
+            return m_maxInFlight;
+        }
+
+        /// <summary>
+        /// Serve requests until input is closed and all responses are written
+        /// </summary>
+        /// <param name="input">file descriptor of requests</param>
+        /// <param name="output">file descriptor of responses</param>
+        /// <returns>count of served requests</returns>
+        size_t serve(int input, int output) {
+            Connection connection { output };
+            std::vector<char> payload{};
+            size_t count{};
+            try {
+                while (SymmetryProtocol::readFrame(input, payload)) {
+                    auto request { parseRequest(payload) };
+
+                    // backpressure: next request is not read while queue is full
+                    {
+                        std::unique_lock<std::mutex> lock(connection.mutex);
+                        connection.done.wait(lock, [&] { return connection.inFlight < m_maxInFlight; });
+                        if (connection.failed) {
+                            break;
+                        }
+                        ++connection.inFlight;
+                    }
+                    m_pool.submit([this, &connection, request] { process(connection, *request); });
+                    ++count;
+                }
+            } catch (...) {
+                wait(connection);
+                throw;
+            }
+            wait(connection);
+            std::lock_guard<std::mutex> lock(connection.mutex);
+            if (connection.failed) {
+                throw std::runtime_error("Response can not be written");
+            }
+            return count;
+        }
+
+        /// <summary>
+        /// Listen Unix domain socket and serve its clients one by one
+        /// </summary>
+        /// <param name="path">path of socket, old file is removed</param>
+        /// <param name="maxConnections">count of served clients, 0 means forever</param>
+        void listen(const std::string& path, size_t maxConnections = 0) {
+            auto address { SymmetryProtocol::getAddress(path) };
+            ::unlink(path.c_str());
+            int server { SymmetryProtocol::createSocket() };
+            if (::bind(server, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+                ::listen(server, 16) != 0) {
+                ::close(server);
+                throw std::runtime_error(std::string("Socket can not be bound: ") + std::strerror(errno));
+            }
+            for (size_t served{}; maxConnections == 0 || served < maxConnections;) {
+                int client { ::accept(server, nullptr, nullptr) };
+                if (client < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    ::close(server);
+                    throw std::runtime_error(std::string("Accept failed: ") + std::strerror(errno));
+                }
+                try {
+                    serve(client, client);
+                } catch (const std::exception&) {
+                    // broken client does not stop server
+                }
+                ::close(client);
+                ++served;
+            }
+            ::close(server);
+            ::unlink(path.c_str());
+        }
+
+    private:
+        struct Request {
+            uint64_t id;
+            double epsilon;
+            std::vector<double> coords;
+        };
+
+        /// <summary>
+        /// Output and in-flight requests of one stream
+        /// </summary>
+        struct Connection {
+            explicit Connection(int fd) : output(fd) {}
+
+            int output;
+            std::mutex writeMutex;
+            std::mutex mutex;
+            std::condition_variable done;
+            size_t inFlight{};
+            bool failed{};
+        };
+
+        static std::shared_ptr<const Request> parseRequest(const std::vector<char>& payload) {
+            constexpr size_t header { sizeof(uint64_t) + sizeof(double) };
+            if (payload.size() < header || (payload.size() - header) % (2 * sizeof(double)) != 0) {
+                throw std::runtime_error("Request has wrong size");
+            }
+            auto request { std::make_shared<Request>() };
+            std::memcpy(&request->id, payload.data(), sizeof(uint64_t));
+            std::memcpy(&request->epsilon, payload.data() + sizeof(uint64_t), sizeof(double));
+            request->coords.resize((payload.size() - header) / sizeof(double));
+            std::memcpy(request->coords.data(), payload.data() + header, payload.size() - header);
+            return request;
+        }
+
+        /// <summary>
+        /// Find axes and write response, it runs on worker of pool
+        /// </summary>
+        void process(Connection& connection, const Request& request) {
+            static thread_local SymmetryWorkspace<double> workspace{};
+            std::vector<char> frame(sizeof(uint32_t));
+            SymmetryProtocol::append(frame, request.id);
+            try {
+                PolygonView<double> view { request.coords.data(), request.coords.data() + 1, request.coords.size() / 2, 2 };
+                const auto& compact { m_finder.findSymmetryCompact(view, request.epsilon, workspace) };
+                SymmetryProtocol::append(frame, SymmetryProtocol::statusOk);
+                SymmetryProtocol::append(frame, static_cast<uint32_t>(compact.size()));
+                for (const auto& axis : compact) {
+                    for (auto position : { axis.first, axis.second }) {
+                        auto point { EdgeAngleSequence<double>::getElementPoint(view, position) };
+                        SymmetryProtocol::append(frame, point.x);
+                        SymmetryProtocol::append(frame, point.y);
+                    }
+                }
+            } catch (const std::exception& ex) {
+                std::string message { ex.what() };
+                frame.resize(sizeof(uint32_t) + sizeof(uint64_t));
+                SymmetryProtocol::append(frame, SymmetryProtocol::statusError);
+                SymmetryProtocol::append(frame, static_cast<uint32_t>(message.size()));
+                frame.insert(frame.end(), message.begin(), message.end());
+            }
+            SymmetryProtocol::finishFrame(frame);
+
+            bool failed{};
+            {
+                std::lock_guard<std::mutex> lock(connection.writeMutex);
+                try {
+                    SymmetryProtocol::writeFully(connection.output, frame.data(), frame.size());
+                } catch (const std::exception&) {
+                    failed = true;
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(connection.mutex);
+                connection.failed = connection.failed || failed;
+                --connection.inFlight;
+            }
+            connection.done.notify_all();
+        }
+
+        /// <summary>
+        /// Wait for all responses of connection
+        /// </summary>
+        static void wait(Connection& connection) {
+            std::unique_lock<std::mutex> lock(connection.mutex);
+            connection.done.wait(lock, [&] { return connection.inFlight == 0; });
+        }
+
+        ThreadPool& m_pool;
+        size_t m_maxInFlight;
+        SymmetryFinder<double> m_finder{};
+};
+
+/// <summary>
+/// Local client of SymmetryServer. Requests are pipelined, so client that sends many requests
+/// must read responses from other thread, else server blocks when output is full
+/// </summary>
+class SymmetryClient {
+    public:
+        /// <summary>
+        /// Init constructor that connects to Unix domain socket of server
+        /// </summary>
+        /// <param name="path">path of socket</param>
+        explicit SymmetryClient(const std::string& path) {
+            auto address { SymmetryProtocol::getAddress(path) };
+            m_input = m_output = SymmetryProtocol::createSocket();
+            if (::connect(m_input, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+                ::close(m_input);
+                throw std::runtime_error(std::string("Socket can not be connected: ") + std::strerror(errno));
+            }
+            m_owned = true;
+        }
+
+        /// <summary>
+        /// Init constructor for streams of server, for example pipes to stdin and stdout of server process
+        /// </summary>
+        /// <param name="requests">file descriptor of server input, it is not owned</param>
+        /// <param name="responses">file descriptor of server output, it is not owned</param>
+        SymmetryClient(int requests, int responses) : m_input(requests), m_output(responses) {}
+
+        SymmetryClient(const SymmetryClient&) = delete;
+        SymmetryClient& operator=(const SymmetryClient&) = delete;
+
+        ~SymmetryClient() {
+            if (m_owned) {
+                ::close(m_input);
+            }
+        }
+
+        /// <summary>
+        /// Send request
+        /// </summary>
+        /// <param name="id">id of request</param>
+        /// <param name="p">view of polygon</param>
+        /// <param name="epsilon">presision</param>
+        void send(uint64_t id, const PolygonView<double>& p, double epsilon) {
+            std::vector<char> frame(sizeof(uint32_t));
+            SymmetryProtocol::append(frame, id);
+            SymmetryProtocol::append(frame, epsilon);
+            for (size_t i{}; i < p.size(); ++i) {
+                SymmetryProtocol::append(frame, p[i].x);
+                SymmetryProtocol::append(frame, p[i].y);
+            }
+            SymmetryProtocol::finishFrame(frame);
+            SymmetryProtocol::writeFully(m_input, frame.data(), frame.size());
+        }
+
+        /// <summary>
+        /// Tell server that there are no more requests, responses can still be received
+        /// </summary>
+        void finish() {
+            if (m_owned) {
+                ::shutdown(m_input, SHUT_WR);
+            } else {
+                ::close(m_input);
+            }
+        }
+
+        /// <summary>
+        /// Receive response
+        /// </summary>
+        /// <param name="response">output: response</param>
+        /// <returns>false if server closed stream else true</returns>
+        bool receive(SymmetryResponse& response) {
+            std::vector<char> payload{};
+            if (!SymmetryProtocol::readFrame(m_output, payload)) {
+                return false;
+            }
+            uint32_t status{}, count{};
+            constexpr size_t header { sizeof(uint64_t) + 2 * sizeof(uint32_t) };
+            if (payload.size() < header) {
+                throw std::runtime_error("Response is too short");
+            }
+            std::memcpy(&response.id, payload.data(), sizeof(uint64_t));
+            std::memcpy(&status, payload.data() + sizeof(uint64_t), sizeof(uint32_t));
+            std::memcpy(&count, payload.data() + sizeof(uint64_t) + sizeof(uint32_t), sizeof(uint32_t));
+            response.ok = status == SymmetryProtocol::statusOk;
+            response.axes.clear();
+            response.error.clear();
+            if (!response.ok) {
+                response.error.assign(payload.data() + header, payload.size() - header);
+                return true;
+            }
+            if (payload.size() != header + size_t{ count } * 4 * sizeof(double)) {
+                throw std::runtime_error("Response has wrong size");
+            }
+            for (size_t i{}; i < count; ++i) {
+                double ends[4]{};
+                std::memcpy(ends, payload.data() + header + i * sizeof(ends), sizeof(ends));
+                response.axes.push_back(Axis<double>(Point2<double>(ends[0], ends[1]), Point2<double>(ends[2], ends[3])));
+            }
+            return true;
+        }
+    private:
+        int m_input{ -1 };
+        int m_output{ -1 };
+        bool m_owned{};
+};
+
+#endif
@@ -0,0 +1,247 @@
+#pragma once
+
+#include "Counter.hpp"
+#include <chrono>
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+/// <summary>
+/// Phase of findSymmetry that is timed by stats
+/// </summary>
+enum class SymmetryPhase {
+    /// <summary>
+    /// Move center of polygon in (0, 0)
+    /// </summary>
+    Centering,
+    /// <summary>
+    /// Check of invariant signature
+    /// </summary>
+    Prefilter,
+    /// <summary>
+    /// Generation of candidates and build of point index
+    /// </summary>
+    Candidates,
+    /// <summary>
+    /// Rotations or reflections of polygon and comparisons of nodes
+    /// </summary>
+    Evaluation,
+    /// <summary>
+    /// Pairing of accepted candidates into axes
+    /// </summary>
+    Pairing,
+    /// <summary>
+    /// Build of edge/angle sequence and its reverse (Linear engine)
+    /// </summary>
+    Sequence,
+    /// <summary>
+    /// KMP matching of sequence against its reverse (Linear engine)
+    /// </summary>
+    Matching,
+    /// <summary>
+    /// Merge of duplicate nodes and removal of collinear nodes before detection
+    /// </summary>
+    Simplify,
+    /// <summary>
+    /// Check of matched axes by positions of nodes (Linear engine)
+    /// </summary>
+    Verification,
+    Count
+};
+
+/// <summary>
+/// Stats policy that collects nothing. All methods are empty, so with this policy
+/// SymmetryFinder has no overhead
+/// </summary>
+struct NoStats {
+    static constexpr bool enabled { false };
+
+    void addTime(SymmetryPhase, std::chrono::nanoseconds) {}
+    void addCandidates(size_t, size_t, size_t) {}
+    void addComparisons(size_t) {}
+    void addEarlyExits(size_t) {}
+    void addPrefilter(size_t, size_t) {}
+    void addAllocated(size_t) {}
+};
+
+/// <summary>
+/// Stats policy that collects time of phases and counters of hot path.
+/// Counters are atomic, so one object can be filled by parallel batch,
+/// time of phases is summed over all polygons and workers.
+/// </summary>
+class SymmetryStats {
+    public:
+        static constexpr bool enabled { true };
+
+        /// <summary>
+        /// Add time of phase
+        /// </summary>
+        /// <param name="phase">timed phase</param>
+        /// <param name="time">wall time of phase</param>
+        void addTime(SymmetryPhase phase, std::chrono::nanoseconds time) {
+            m_time[static_cast<size_t>(phase)].add(static_cast<size_t>(time.count()));
+        }
+
+        /// <summary>
+        /// Add counts of candidates
+        /// </summary>
+        /// <param name="generated">count of generated candidates</param>
+        /// <param name="tested">count of candidates that are compared with polygon</param>
+        /// <param name="accepted">count of accepted candidates</param>
+        void addCandidates(size_t generated, size_t tested, size_t accepted) {
+            m_generated.add(generated);
+            m_tested.add(tested);
+            m_accepted.add(accepted);
+        }
+
+        /// <summary>
+        /// Add count of compared points or tokens
+        /// </summary>
+        void addComparisons(size_t count) {
+            m_comparisons.add(count);
+        }
+
+        /// <summary>
+        /// Add count of polygons or candidates that are rejected before full comparison
+        /// </summary>
+        void addEarlyExits(size_t count) {
+            m_earlyExits.add(count);
+        }
+
+        /// <summary>
+        /// Add counts of polygons that are checked and rejected by invariant signature
+        /// </summary>
+        /// <param name="checked">count of checked polygons</param>
+        /// <param name="rejected">count of rejected polygons</param>
+        void addPrefilter(size_t checked, size_t rejected) {
+            m_prefilterChecked.add(checked);
+            m_prefilterRejected.add(rejected);
+        }
+
+        /// <summary>
+        /// Add size of allocated buffers
+        /// </summary>
+        /// <param name="bytes">count of bytes</param>
+        void addAllocated(size_t bytes) {
+            m_allocated.add(bytes);
+        }
+
+        /// <summary>
+        /// Get time of phase
+        /// </summary>
+        /// <param name="phase">timed phase</param>
+        /// <returns>summed wall time</returns>
+        std::chrono::nanoseconds getTime(SymmetryPhase phase) const {
+            return std::chrono::nanoseconds(m_time[static_cast<size_t>(phase)].get());
+        }
+
+        size_t getGenerated() const { return m_generated.get(); }
+        size_t getTested() const { return m_tested.get(); }
+        size_t getAccepted() const { return m_accepted.get(); }
+        size_t getComparisons() const { return m_comparisons.get(); }
+        size_t getEarlyExits() const { return m_earlyExits.get(); }
+        size_t getPrefilterChecked() const { return m_prefilterChecked.get(); }
+        size_t getPrefilterRejected() const { return m_prefilterRejected.get(); }
+        size_t getAllocated() const { return m_allocated.get(); }
+
+        /// <summary>
+        /// Set all stats to 0
+        /// </summary>
+        void reset() {
+            for (auto& time : m_time) {
+                time.reset();
+            }
+            m_generated.reset();
+            m_tested.reset();
+            m_accepted.reset();
+            m_comparisons.reset();
+            m_earlyExits.reset();
+            m_prefilterChecked.reset();
+            m_prefilterRejected.reset();
+            m_allocated.reset();
+        }
+
+        /// <summary>
+        /// Get stats as text, one value per line
+        /// </summary>
+        /// <returns>string with stats</returns>
+        std::string toString() const {
+            static const char* names[] { "centering", "prefilter", "candidates", "evaluation", "pairing", "sequence", "matching", "simplify", "verification" };
+            std::ostringstream out{};
+            for (size_t i{}; i < static_cast<size_t>(SymmetryPhase::Count); ++i) {
+                out << "time." << names[i] << ": " << m_time[i].get() / 1e6 << " ms\n";
+            }
+            out << "candidates.generated: " << getGenerated() << "\n"
+                << "candidates.tested: " << getTested() << "\n"
+                << "candidates.accepted: " << getAccepted() << "\n"
+                << "comparisons: " << getComparisons() << "\n"
+                << "earlyExits: " << getEarlyExits() << "\n"
+                << "prefilter.checked: " << getPrefilterChecked() << "\n"
+                << "prefilter.rejected: " << getPrefilterRejected() << "\n"
+                << "bytesAllocated: " << getAllocated() << "\n";
+            return out.str();
+        }
+    private:
+        Counter m_time[static_cast<size_t>(SymmetryPhase::Count)];
+        Counter m_generated, m_tested, m_accepted;
+        Counter m_comparisons;
+        Counter m_earlyExits;
+        Counter m_prefilterChecked, m_prefilterRejected;
+        Counter m_allocated;
+};
+
+/// <summary>
+/// Timer of consecutive phases. Clock is read only if stats are enabled
+/// </summary>
+/// <typeparam name="Stats">stats policy</typeparam>
+template <class Stats>
+class PhaseTimer {
+    public:
+        /// <summary>
+        /// Init constructor, starts first phase
+        /// </summary>
+        /// <param name="stats">filled stats</param>
+        /// <param name="phase">first phase</param>
+        PhaseTimer(Stats& stats, SymmetryPhase phase) : m_stats(stats), m_phase(phase) {
+            if constexpr (Stats::enabled) {
+                m_start = std::chrono::steady_clock::now();
+            }
+        }
+
+        PhaseTimer(const PhaseTimer&) = delete;
+        PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+        ~PhaseTimer() {
+            stop();
+        }
+
+        /// <summary>
+        /// Finish current phase and start next phase
+        /// </summary>
+        /// <param name="phase">next phase</param>
+        void next(SymmetryPhase phase) {
+            stop();
+            m_phase = phase;
+            m_stopped = false;
+        }
+
+        /// <summary>
+        /// Finish current phase
+        /// </summary>
+        void stop() {
+            if constexpr (Stats::enabled) {
+                if (m_stopped) {
+                    return;
+                }
+                auto now { std::chrono::steady_clock::now() };
+                m_stats.addTime(m_phase, std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_start));
+                m_start = now;
+            }
+            m_stopped = true;
+        }
+    private:
+        Stats& m_stats;
+        SymmetryPhase m_phase;
+        std::chrono::steady_clock::time_point m_start{};
+        bool m_stopped{};
+};
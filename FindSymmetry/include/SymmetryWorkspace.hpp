@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Polygon.hpp"
+#include "Axis.hpp"
+#include "CompactAxis.hpp"
+#include "EdgeAngleSequence.hpp"
+#include "InvariantSignature.hpp"
+#include "PointIndex.hpp"
+#include "CandidateProbe.hpp"
+#include "ReflectKernel.hpp"
+#include "PolygonSimplifier.hpp"
+#include "AxisVerifier.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+template <class T, class StatsPolicy>
+class SymmetryFinder;
+
+/// <summary>
+/// Accepted candidates of one axis: range of candidates sorted by angle and extreme
+/// candidates along direction of axis
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+struct AngleBucket {
+    size_t begin;
+    size_t end;
+    T angle;
+    size_t target{ SIZE_MAX };
+    Point2<T> direction{};
+    size_t minIndex{ SIZE_MAX };
+    size_t maxIndex{ SIZE_MAX };
+    T minProjection{};
+    T maxProjection{};
+
+    /// <summary>
+    /// Add candidate into extremes of bucket
+    /// </summary>
+    /// <param name="candidates">all candidates</param>
+    /// <param name="index">index of added candidate</param>
+    void add(const std::vector<Point2<T>>& candidates, size_t index) {
+        T projection { direction.dot(candidates[index]) };
+        if (minIndex == SIZE_MAX || projection < minProjection) {
+            minProjection = projection;
+            minIndex = index;
+        }
+        if (maxIndex == SIZE_MAX || projection > maxProjection) {
+            maxProjection = projection;
+            maxIndex = index;
+        }
+    }
+};
+
+/// <summary>
+/// Buffers of SymmetryFinder that are owned by caller and reused between calls.
+/// All buffers only grow, so after first calls with the biggest polygon
+/// findSymmetry with workspace makes no heap allocations (candidates that are
+/// evaluated by workers of pool still allocate tasks of pool).
+/// Workspace must not be used by several threads at once.
+/// </summary>
+/// <typeparam name="T">template parameter</typeparam>
+template <class T>
+class SymmetryWorkspace {
+    public:
+        /// <summary>
+        /// Get axes that were found by last call
+        /// </summary>
+        /// <returns>readonly axes</returns>
+        const std::vector<Axis<RealOf<T>>>& getAxes() const {
+            return m_axes;
+        }
+
+        /// <summary>
+        /// Get compact axes that were found by last call. Also for simplified polygon they are
+        /// positions of elements of original polygon
+        /// </summary>
+        /// <returns>readonly compact axes</returns>
+        const std::vector<CompactAxis>& getCompactAxes() const {
+            return m_compact;
+        }
+
+        /// <summary>
+        /// Get size of all buffers
+        /// </summary>
+        /// <returns>count of bytes</returns>
+        size_t getMemorySize() const {
+            size_t size { m_sequence.getTokens().capacity() * sizeof(SequenceToken<T>) +
+                          m_reversed.capacity() * sizeof(SequenceToken<T>) +
+                          (m_prefix.capacity() + m_shifts.capacity() + m_rotations.capacity() + m_accepted.capacity()) * sizeof(size_t) +
+                          (m_polygon.getNodes().capacity() + m_candidates.capacity()) * sizeof(Point2<T>) +
+                          m_signature.getMemorySize() + m_index.getMemorySize() + m_targets.getMemorySize() +
+                          m_angles.capacity() * sizeof(std::pair<T, size_t>) + m_buckets.capacity() * sizeof(AngleBucket<T>) +
+                          m_simplifier.getMemorySize() + m_verifier.getMemorySize() +
+                          m_compact.capacity() * sizeof(CompactAxis) + m_axes.capacity() * sizeof(Axis<RealOf<T>>) };
+            for (const auto& polygon : m_rotated) {
+                size += polygon.getNodes().capacity() * sizeof(Point2<T>);
+            }
+            for (const auto& slice : m_slices) {
+                size += slice.capacity() * sizeof(size_t);
+            }
+            return size;
+        }
+    private:
+        template <class, class>
+        friend class SymmetryFinder;
+
+        // Simplification before detection
+        PolygonSimplifier<T> m_simplifier;
+
+        // Linear engine
+        EdgeAngleSequence<T> m_sequence;
+        std::vector<SequenceToken<T>> m_reversed;
+        std::vector<size_t> m_prefix, m_shifts, m_rotations;
+        AxisVerifier<T> m_verifier;
+
+        // Vectorized and Reference engines
+        Polygon<T> m_polygon;
+        InvariantSignature<T> m_signature;
+        std::vector<Point2<T>> m_candidates;
+        PointIndex<T> m_index;
+        CandidateProbe<T> m_probe;
+        ReflectionTargets<T> m_targets;
+        std::vector<Polygon<T>> m_rotated;
+        std::vector<size_t> m_accepted;
+        std::vector<std::vector<size_t>> m_slices;
+        std::vector<std::pair<T, size_t>> m_angles;
+        std::vector<AngleBucket<T>> m_buckets;
+
+        // Result
+        std::vector<CompactAxis> m_compact;
+        std::vector<Axis<RealOf<T>>> m_axes;
+};
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Thread pool with work stealing. Every worker owns a deque of tasks: worker takes tasks
+/// from back of own deque and steals from front of other deques when own deque is empty.
+/// Thread that waits for parallelFor also executes tasks, so nested calls do not block workers,
+/// and sleeps together with workers when there is no task to take.
+/// </summary>
+class ThreadPool {
+    public:
+        /// <summary>
+        /// Init constructor
+        /// </summary>
+        /// <param name="threadCount">count of workers, 0 means count of hardware threads</param>
+        explicit ThreadPool(size_t threadCount = 0) {
+            if (threadCount == 0) {
+                threadCount = std::max(1u, std::thread::hardware_concurrency());
+            }
+
+            for (size_t i{}; i < threadCount; ++i) {
+                m_queues.push_back(std::unique_ptr<Queue>(new Queue{}));
+            }
+            for (size_t i{}; i < threadCount; ++i) {
+                m_threads.emplace_back([this, i] { workerLoop(i); });
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /// <summary>
+        /// Stop all workers. Tasks that are not started are dropped
+        /// </summary>
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(m_sleepMutex);
+                m_stop = true;
+            }
+            m_wakeUp.notify_all();
+
+            for (auto& thread : m_threads) {
+                thread.join();
+            }
+        }
+
+        /// <summary>
+        /// Get count of workers
+        /// </summary>
+        /// <returns>count of workers</returns>
+        size_t getThreadCount() const {
+            return m_threads.size();
+        }
+
+        /// <summary>
+        /// Call body(i) for every i in [0, count) and wait for finish.
+        /// Range is split in halves until it is not bigger than grain, so idle workers
+        /// can steal big parts of work. First exception from body is rethrown.
+        /// </summary>
+        /// <param name="count">count of iterations</param>
+        /// <param name="grain">max count of iterations in one task</param>
+        /// <param name="body">function of iteration index</param>
+        template <class Body>
+        void parallelFor(size_t count, size_t grain, Body body) {
+            if (count == 0) {
+                return;
+            }
+            grain = std::max<size_t>(grain, 1);
+
+            // tasks own the shared state, so a worker that made the last decrement can still
+            // use the closure and notify after the caller has returned
+            auto state { std::make_shared<ParallelForState>() };
+            state->remaining = count;
+            std::weak_ptr<ParallelForState> weakState { state };
+            state->process = [this, weakState, grain, &body](size_t begin, size_t end) {
+                // executor of this call holds own reference, so lock always succeeds
+                auto owner { weakState.lock() };
+                while (end - begin > grain) {
+                    size_t middle { begin + (end - begin) / 2 };
+                    push([owner, middle, end] { owner->process(middle, end); });
+                    end = middle;
+                }
+
+                try {
+                    for (size_t i{ begin }; i < end; ++i) {
+                        body(i);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(owner->errorMutex);
+                    if (!owner->error) {
+                        owner->error = std::current_exception();
+                    }
+                }
+                if ((owner->remaining -= end - begin) == 0) {
+                    // lock guarantees that waiting caller checked remaining before notify
+                    {
+                        std::lock_guard<std::mutex> lock(m_sleepMutex);
+                    }
+                    m_wakeUp.notify_all();
+                }
+            };
+
+            state->process(0, count);
+
+            // help workers until all iterations are done, sleep while there is no task to take
+            while (state->remaining > 0) {
+                Task task{};
+                if (tryPop(task)) {
+                    task();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+                m_wakeUp.wait(lock, [this, &state] { return state->remaining == 0 || m_queued > 0; });
+            }
+
+            if (state->error) {
+                std::rethrow_exception(state->error);
+            }
+        }
+
+        /// <summary>
+        /// Run task on some worker without wait. Task must not throw, caller waits for it by own means
+        /// </summary>
+        /// <param name="task">function without arguments</param>
+        template <class Function>
+        void submit(Function task) {
+            push(Task(std::move(task)));
+        }
+
+        /// <summary>
+        /// Get pool that is shared by whole process
+        /// </summary>
+        /// <returns>pool with count of workers equal to count of hardware threads</returns>
+        static ThreadPool& getDefault() {
+            static ThreadPool pool{};
+            return pool;
+        }
+    private:
+        using Task = std::function<void()>;
+
+        /// <summary>
+        /// State of one parallelFor call, shared by caller and all its tasks
+        /// </summary>
+        struct ParallelForState {
+            std::atomic<size_t> remaining;
+            std::exception_ptr error;
+            std::mutex errorMutex;
+            std::function<void(size_t, size_t)> process;
+        };
+
+        struct Queue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        /// <summary>
+        /// Worker of current thread
+        /// </summary>
+        struct Current {
+            ThreadPool* pool;
+            size_t index;
+        };
+
+        static Current& current() {
+            static thread_local Current value{ nullptr, 0 };
+            return value;
+        }
+
+        /// <summary>
+        /// Push task into own deque for worker thread, else into deques by round robin
+        /// </summary>
+        /// <param name="task">pushed task</param>
+        void push(Task task) {
+            auto& self { current() };
+            size_t index { self.pool == this ? self.index : m_next++ % m_queues.size() };
+            {
+                std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+                m_queues[index]->tasks.push_back(std::move(task));
+            }
+            ++m_queued;
+
+            // lock guarantees that sleeping worker checked m_queued before notify
+            {
+                std::lock_guard<std::mutex> lock(m_sleepMutex);
+            }
+            m_wakeUp.notify_one();
+        }
+
+        /// <summary>
+        /// Pop task from back of own deque or steal from front of another deque
+        /// </summary>
+        /// <param name="task">output task</param>
+        /// <returns>true if task is found else false</returns>
+        bool tryPop(Task& task) {
+            auto& self { current() };
+            size_t size { m_queues.size() }, start { self.pool == this ? self.index : 0 };
+
+            if (self.pool == this) {
+                auto& queue { *m_queues[start] };
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (!queue.tasks.empty()) {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                    --m_queued;
+                    return true;
+                }
+            }
+
+            for (size_t i{ 1 }; i <= size; ++i) {
+                auto& queue { *m_queues[(start + i) % size] };
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (!queue.tasks.empty()) {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                    --m_queued;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /// <summary>
+        /// Main loop of worker
+        /// </summary>
+        /// <param name="index">index of worker</param>
+        void workerLoop(size_t index) {
+            current() = Current{ this, index };
+
+            while (true) {
+                Task task{};
+                if (tryPop(task)) {
+                    task();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+                m_wakeUp.wait(lock, [this] { return m_stop || m_queued > 0; });
+                if (m_stop) {
+                    return;
+                }
+            }
+        }
+
+        std::vector<std::unique_ptr<Queue>> m_queues;
+        std::vector<std::thread> m_threads;
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wakeUp;
+        std::atomic<size_t> m_queued{};
+        std::atomic<size_t> m_next{};
+        bool m_stop{};
+};
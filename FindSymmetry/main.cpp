@@ -1,48 +1,59 @@
-
 #include "SymmetryFinder.hpp"
 #include "Point2.hpp"
+#include "PolygonReader.hpp"
+#include "PolygonFile.hpp"
+#include "ApproximateSymmetry.hpp"
+#include "CurveSymmetry.hpp"
+#include "SymmetryServer.hpp"
+#include "SymmetryPipeline.hpp"
+#include "SymmetryCache.hpp"
+#include "PointSetSymmetry.hpp"
+#include "AxisWriter.hpp"
+#include <csignal>
+#include <cstdint>
 #include <iostream>
-#include <fstream>
-
-/// <summary>
-/// Write all axes in console
-/// </summary>
-/// <typeparam name="T">template parameter</typeparam>
-/// <param name="axes">vector of axes that contains axes of symmetry</param>
-template<typename T>
-void writeAxes(std::vector<Axis<T>>& axes) {
-    for (const auto& axis : axes) {
-        std::cout << axis.toString() << std::endl;
-    }
-}
+#include <memory>
+#include <string>
+#include <stdexcept>
 
 /// <summary>
-/// Read polygon from file
+/// Find axes of symmetry for all polygons
 /// </summary>
-/// <typeparam name="T">template parameter</typeparam>
-/// <param name="filename">string that contains directory for file</param>
-/// <returns>polygon object</returns>
-template<typename T>
-Polygon<T> readPolygon(std::string filename) {
-    std::vector<Point2<double>> nodes{};
-
-    std::ifstream in(filename);
-    if (!in.is_open()) {
-        throw std::exception("File not found");
-    }
-
-    while (!in.eof()) {
-       double x{}, y{};
-       in >> x >> y;
-       nodes.push_back(Point2<double>(x, y));
+/// <typeparam name="StatsPolicy">NoStats or SymmetryStats</typeparam>
+/// <param name="polygons">views of polygons</param>
+/// <param name="engine">algorithm for find axes</param>
+/// <param name="simplifyThreshold">polygons with less count of nodes are not simplified, SIZE_MAX disables simplification</param>
+/// <returns>axes of symmetry for every polygon</returns>
+template<class StatsPolicy>
+std::vector<std::vector<Axis<double>>> findAxes(const std::vector<PolygonView<double>>& polygons, SymmetryEngine engine, size_t simplifyThreshold) {
+    SymmetryFinder<double, StatsPolicy> finder { engine };
+    finder.setSimplifyThreshold(simplifyThreshold);
+    auto results { finder.findSymmetryBatch(std::span<const PolygonView<double>>(polygons), 1e-8) };
+    if constexpr (StatsPolicy::enabled) {
+        std::cerr << finder.getStats().toString();
     }
-    in.close();
-
-    return Polygon<T> { nodes };
+    return results;
 }
 
 /// <summary>
-/// Entry point for find axes of symmetry
+/// Entry point for find axes of symmetry.
+/// Every argument is a text or binary file with polygons, all polygons are processed in parallel.
+/// "--convert in out" converts text file into binary file,
+/// "--serve [socket]" serves length-prefixed requests from stdin or from Unix domain socket,
+/// "--stats" prints time of phases and counters in stderr,
+/// "--approximate" prints best axis of approximate symmetry with its RMS and max reflection errors,
+/// "--curve" finds axes of smooth curve that is sampled by nodes with irregular spacing,
+/// "--pipeline" streams large batches through read, center, detect and write stages,
+/// "--cache" reuses axes of congruent polygons, with "--stats" hits and misses are printed in stderr,
+/// "--mixed" screens candidates in float and verifies survivors in double,
+/// "--simplify[=threshold]" merges duplicate nodes and removes collinear nodes of polygons with at least
+/// threshold nodes (all polygons without threshold) before find axes, polygons with at least 4096 nodes
+/// are simplified by default, "--no-simplify" disables simplification,
+/// "--points" reads every polygon as unordered point set,
+/// "--format text|json|binary" selects format of written axes.
+/// Modes "--approximate", "--curve", "--points", "--cache" and "--pipeline" exclude each other,
+/// "--stats" is supported by default mode and "--cache", "--mixed" and simplification flags only by default mode,
+/// "--format" is not supported by "--approximate". Other combinations are rejected
 /// </summary>
 /// <param name="argc">arguments count</param>
 /// <param name="argv">vector of arguments</param>
@@ -52,23 +63,193 @@ int main(int argc, char* argv[]) {
         
         //Parse command arguments
         if (argc < 2) {
-            throw std::exception("Run program with filename as parameter");
+            throw std::runtime_error("Run program with filename as parameter");
+        }
+
+        //Convert text file into binary file
+        if (std::string(argv[1]) == "--convert") {
+            if (argc != 4) {
+                throw std::runtime_error("Run program with --convert input output");
+            }
+            auto count { convertPolygonFile(argv[2], argv[3]) };
+            std::cout << count << " polygons converted" << std::endl;
+            return 0;
         }
 
-        //Read polygon from file 
-        std::string filename{ argv[1] };
-        auto poly { readPolygon<double>(filename) };
+        //Serve stream of requests by one process and one thread pool
+        if (std::string(argv[1]) == "--serve") {
+#ifndef _WIN32
+            ::signal(SIGPIPE, SIG_IGN);
+            SymmetryServer server{};
+            if (argc == 3) {
+                server.listen(argv[2]);
+            } else {
+                server.serve(STDIN_FILENO, STDOUT_FILENO);
+            }
+            return 0;
+#else
+            throw std::runtime_error("--serve is not supported on Windows");
+#endif
+        }
+
+        std::vector<std::string> filenames{};
+        bool stats{}, approximate{}, curve{}, pipeline{}, cache{}, mixed{}, points{}, formatted{};
+        std::string simplify{}; // simplification flag as it was typed
+        size_t simplifyThreshold { SymmetryFinder<double>::kDefaultSimplifyThreshold };
+        AxisFormat format { AxisFormat::Text };
+        for (int i{ 1 }; i < argc; ++i) {
+            if (std::string(argv[i]) == "--format") {
+                formatted = true;
+                std::string name { i + 1 < argc ? argv[++i] : "" };
+                if (name == "text") {
+                    format = AxisFormat::Text;
+                } else if (name == "json") {
+                    format = AxisFormat::Json;
+                } else if (name == "binary") {
+                    format = AxisFormat::Binary;
+                } else {
+                    throw std::runtime_error("Run program with --format text, json or binary");
+                }
+            } else if (std::string(argv[i]) == "--stats") {
+                stats = true;
+            } else if (std::string(argv[i]) == "--approximate") {
+                approximate = true;
+            } else if (std::string(argv[i]) == "--curve") {
+                curve = true;
+            } else if (std::string(argv[i]) == "--pipeline") {
+                pipeline = true;
+            } else if (std::string(argv[i]) == "--cache") {
+                cache = true;
+            } else if (std::string(argv[i]) == "--mixed") {
+                mixed = true;
+            } else if (std::string(argv[i]) == "--simplify") {
+                simplify = argv[i];
+                simplifyThreshold = 0;
+            } else if (std::string(argv[i]).starts_with("--simplify=")) {
+                std::string value { std::string(argv[i]).substr(11) };
+                if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos) {
+                    throw std::runtime_error("Run program with --simplify=threshold");
+                }
+                simplify = argv[i];
+                simplifyThreshold = std::stoull(value);
+            } else if (std::string(argv[i]) == "--no-simplify") {
+                simplify = argv[i];
+                simplifyThreshold = SIZE_MAX;
+            } else if (std::string(argv[i]) == "--points") {
+                points = true;
+            } else {
+                filenames.push_back(argv[i]);
+            }
+        }
+        if (filenames.empty()) {
+            throw std::runtime_error("Run program with filename as parameter");
+        }
+
+        //Reject flags that are not supported by selected mode
+        std::string mode{};
+        for (const auto& [flag, enabled] : { std::pair{ "--approximate", approximate }, std::pair{ "--curve", curve },
+                                             std::pair{ "--points", points }, std::pair{ "--cache", cache },
+                                             std::pair{ "--pipeline", pipeline } }) {
+            if (!enabled) {
+                continue;
+            }
+            if (!mode.empty()) {
+                throw std::runtime_error(mode + " can not be used with " + flag);
+            }
+            mode = flag;
+        }
+        if (stats && !mode.empty() && !cache) {
+            throw std::runtime_error("--stats can not be used with " + mode);
+        }
+        if (mixed && !mode.empty()) {
+            throw std::runtime_error("--mixed can not be used with " + mode);
+        }
+        if (!simplify.empty() && !mode.empty()) {
+            throw std::runtime_error(simplify + " can not be used with " + mode);
+        }
+        if (formatted && approximate) {
+            throw std::runtime_error("--format can not be used with --approximate");
+        }
+
+        //Read, find and write by stages that run at once, polygons are not kept in memory
+        if (pipeline) {
+            SymmetryPipeline{}.run(filenames, std::cout, 1e-8, format);
+            return 0;
+        }
+
+        //Read polygons from files, file can contain several polygons.
+        //Binary files are mapped and polygons are not copied
+        std::vector<std::string> labels{};
+        std::vector<std::unique_ptr<PolygonFile>> binaryFiles{};
+        std::vector<std::vector<Polygon<double>>> textFiles{};
+        std::vector<PolygonView<double>> polygons{};
+        for (const auto& filename : filenames) {
+            std::vector<PolygonView<double>> filePolygons{};
+            if (PolygonFile::isPolygonFile(filename)) {
+                binaryFiles.push_back(std::make_unique<PolygonFile>(filename));
+                filePolygons = binaryFiles.back()->getViews();
+            } else {
+                textFiles.push_back(readPolygons<double>(filename));
+                for (const auto& polygon : textFiles.back()) {
+                    filePolygons.push_back(PolygonView<double>(polygon));
+                }
+            }
+            if (filePolygons.empty()) {
+                throw std::runtime_error("File has no polygon: " + filename);
+            }
+            for (size_t k{}; k < filePolygons.size(); ++k) {
+                labels.push_back(filePolygons.size() > 1 ? filename + "[" + std::to_string(k) + "]" : filename);
+                polygons.push_back(filePolygons[k]);
+            }
+        }
+
+        //Find best axis of approximate symmetry
+        if (approximate) {
+            ApproximateSymmetry<double> finder{};
+            for (size_t i{}; i < polygons.size(); ++i) {
+                if (polygons.size() > 1) {
+                    std::cout << labels[i] << ":" << std::endl;
+                }
+                for (const auto& axis : finder.findAxes(polygons[i], 1)) {
+                    std::cout << axis.axis.toString() << " rms " << axis.rmsError << " max " << axis.maxError << std::endl;
+                }
+            }
+            return 0;
+        }
         
         //Find axes of symmetry
-        SymmetryFinder<double> finder{};
-        auto result { finder.findSymmetry(poly, 1e-8) };
-
-        //Print results
-        if (result.size() == 0) {
-            std::cout << "non-symmetric" << std::endl;
+        std::vector<std::vector<Axis<double>>> results{};
+        if (curve) {
+            CurveSymmetry<double> finder{};
+            for (const auto& polygon : polygons) {
+                results.push_back(finder.findSymmetry(polygon, 1e-4));
+            }
+        } else if (points) {
+            PointSetSymmetry<double> finder{};
+            for (const auto& polygon : polygons) {
+                results.push_back(finder.findSymmetry(PointSet<double>{ polygon.toPolygon().getNodes() }, 1e-8));
+            }
+        } else if (cache) {
+            SymmetryCache<double> finder{};
+            for (const auto& polygon : polygons) {
+                results.push_back(finder.findSymmetry(polygon, 1e-8));
+            }
+            if (stats) {
+                std::cerr << "cache hits " << finder.getHits() << " misses " << finder.getMisses()
+                          << " collisions " << finder.getCollisions() << std::endl;
+            }
         } else {
-            writeAxes<double>(result);
+            auto engine { mixed ? SymmetryEngine::MixedPrecision : SymmetryEngine::Linear };
+            results = stats ? findAxes<SymmetryStats>(polygons, engine, simplifyThreshold)
+                            : findAxes<NoStats>(polygons, engine, simplifyThreshold);
+        }
+
+        //Print results by one buffer, stream is flushed once
+        AxisWriter writer { std::cout, format };
+        for (size_t i{}; i < results.size(); ++i) {
+            writer.write(results.size() > 1 || format != AxisFormat::Text ? std::string_view(labels[i]) : std::string_view(), results[i]);
         }
+        writer.flush();
          
         return 0;
    }
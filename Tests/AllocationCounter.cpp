@@ -0,0 +1,50 @@
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// operators are defined in own translation unit without new-expressions,
+// so compiler does not pair malloc and free of them with inlined new and delete
+static std::atomic<bool> countAllocations{};
+static std::atomic<size_t> allocations{};
+
+void AllocationCounter::start() {
+    allocations = 0;
+    countAllocations = true;
+}
+
+size_t AllocationCounter::stop() {
+    countAllocations = false;
+    return allocations.load();
+}
+
+void* operator new(size_t size) {
+    if (countAllocations) {
+        ++allocations;
+    }
+    if (void* p { std::malloc(size == 0 ? 1 : size) }) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    std::free(p);
+}
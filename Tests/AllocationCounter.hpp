@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+
+/// <summary>
+/// Counter of heap allocations of UnitTestAllocations binary. Global operator new is
+/// replaced only in that binary (AllocationCounter.cpp), so other suites use default operators
+/// </summary>
+namespace AllocationCounter {
+    /// <summary>
+    /// Set count to 0 and start counting
+    /// </summary>
+    void start();
+
+    /// <summary>
+    /// Stop counting
+    /// </summary>
+    /// <returns>count of allocations after start</returns>
+    size_t stop();
+}
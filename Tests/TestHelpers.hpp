@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include "Axis.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <vector>
+
+/// <summary>
+/// Check that both vectors have the same axes in any order
+/// </summary>
+/// <param name="a">first axes</param>
+/// <param name="b">second axes</param>
+/// <param name="epsilon">presision of endpoints</param>
+/// <returns>true if every axis of a is in b and sizes are equal</returns>
+inline bool compareAxes(std::vector<Axis<double>>& a, std::vector<Axis<double>>& b, double epsilon) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i{}; i < a.size(); ++i) {
+        bool isEqual{};
+        for (size_t j{}; j < b.size() && !isEqual; ++j) {
+            isEqual = a[i].isEqual(b[j], epsilon);
+        }
+        if (!isEqual) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// <summary>
+/// Regular polygon with center in (0, 0) and node 0 on x axis
+/// </summary>
+/// <param name="size">count of nodes</param>
+/// <param name="radius">distance of nodes from center</param>
+/// <returns>polygon</returns>
+inline Polygon<double> regularPolygon(size_t size, double radius) {
+    std::vector<Point2<double>> nodes{};
+    for (size_t i{}; i < size; ++i) {
+        double angle { 2 * std::numbers::pi * i / size };
+        nodes.push_back(Point2<double>(radius * std::cos(angle), radius * std::sin(angle)));
+    }
+    return Polygon<double>{ nodes };
+}
+
+/// <summary>
+/// Get angle of axis line in [0, pi), angle near pi is 0
+/// </summary>
+/// <param name="axis">axis</param>
+/// <returns>angle of direction of axis</returns>
+inline double getAngle(const Axis<double>& axis) {
+    auto d { axis.getEnd() - axis.getStart() };
+    double angle { std::fmod(std::atan2(d.y, d.x) + 2 * std::numbers::pi, std::numbers::pi) };
+    return angle > std::numbers::pi - 1e-9 ? 0 : angle;
+}
@@ -166,4 +166,34 @@ TEST(PresisionTest, SymmetricHexagonAxes) {
     SymmetryFinder<double> finder{};
     auto result { finder.findSymmetry(poly, epsilon) };
     EXPECT_TRUE(compareAxes(axes, result));
-}
\ No newline at end of file
+}
+TEST(PresisionTest, NodeInCenterAxes) {
+    // node (0,0) is centroid of nodes, it must not be taken as direction of axis
+    std::vector<Axis<double>> axes
+    {
+       { Point2<double>(0,0), Point2<double>(0,4) },
+    };
+    Polygon<double> poly
+    {
+       std::vector<Point2<double>>
+       {
+          {0,0},
+          {2,-2},
+          {0,4},
+          {-2,-2},
+       }
+    };
+    for (auto engine : { SymmetryEngine::Linear, SymmetryEngine::Vectorized, SymmetryEngine::MixedPrecision,
+                          SymmetryEngine::Reference }) {
+        SymmetryFinder<double> finder{ engine };
+        auto result { finder.findSymmetry(poly, epsilon) };
+        EXPECT_TRUE(compareAxes(axes, result));
+        auto group { finder.findSymmetryGroup(poly, epsilon) };
+        EXPECT_EQ(group.rotationOrder, 1);
+        EXPECT_TRUE(compareAxes(axes, group.axes));
+    }
+    Polygon<int64_t> lattice { std::vector<Point2<int64_t>>{ {0,0}, {2,-2}, {0,4}, {-2,-2} } };
+    SymmetryFinder<int64_t> exact{};
+    auto result { exact.findSymmetry(lattice, 0) };
+    EXPECT_TRUE(compareAxes(axes, result));
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "PolygonView.hpp"
+#include "Point2.hpp"
+#include "SymmetryFinder.hpp"
+#include "SymmetryWorkspace.hpp"
+#include "TestHelpers.hpp"
+#include "AllocationCounter.hpp"
+
+#include <cstdint>
+#include <vector>
+
+TEST(AllocationsTest, NoAllocationsAfterWarmUp) {
+    std::vector<Polygon<double>> polygons { regularPolygon(100, 1.0), regularPolygon(12, 5.0),
+                                            Polygon<double>{ { { 0, 0 }, { 4, 0 }, { 5, 2 }, { 1, 3 } } } };
+    for (auto engine : { SymmetryEngine::Linear, SymmetryEngine::Vectorized, SymmetryEngine::Reference }) {
+        SymmetryFinder<double> finder { engine };
+        SymmetryWorkspace<double> workspace{};
+        std::vector<PolygonView<double>> views{};
+        for (const auto& poly : polygons) {
+            views.push_back(PolygonView<double>(poly));
+            finder.findSymmetry(views.back(), 1e-8, workspace);
+        }
+
+        AllocationCounter::start();
+        size_t count{};
+        for (int repeat{}; repeat < 3; ++repeat) {
+            for (const auto& view : views) {
+                count += finder.findSymmetry(view, 1e-8, workspace).size();
+            }
+        }
+        auto allocations { AllocationCounter::stop() };
+
+        EXPECT_EQ(allocations, 0u);
+        EXPECT_EQ(count, 3u * (100 + 12));
+    }
+}
+
+TEST(AllocationsTest, IntegerNoAllocationsAfterWarmUp) {
+    Polygon<int64_t> poly { { { 0, 0 }, { 6, 0 }, { 6, 4 }, { 0, 4 } } };
+    SymmetryFinder<int64_t> finder{};
+    SymmetryWorkspace<int64_t> workspace{};
+    PolygonView<int64_t> view { poly };
+    finder.findSymmetry(view, 0, workspace);
+
+    AllocationCounter::start();
+    auto size { finder.findSymmetry(view, 0, workspace).size() };
+    auto allocations { AllocationCounter::stop() };
+
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(size, 2u);
+}
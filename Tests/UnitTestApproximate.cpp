@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include "ApproximateSymmetry.hpp"
+#include "TestHelpers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+static Polygon<double> ellipse(size_t size, double a, double b, double noise, unsigned seed = 1) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> jitter(-noise, noise);
+    std::vector<Point2<double>> nodes{};
+    for (size_t i{}; i < size; ++i) {
+        double angle { 2 * std::acos(-1) * i / size };
+        nodes.push_back(Point2<double>(a * std::cos(angle) + jitter(gen), b * std::sin(angle) + jitter(gen)));
+    }
+    return Polygon<double>{ nodes };
+}
+
+TEST(ApproximateTest, RegularPolygonHasSmallErrors) {
+    std::vector<Point2<double>> nodes{};
+    for (size_t i{}; i < 6; ++i) {
+        double angle { 2 * std::acos(-1) * i / 6 };
+        nodes.push_back(Point2<double>(3 * std::cos(angle), 3 * std::sin(angle)));
+    }
+    ApproximateSymmetry<double> finder{};
+    auto axes { finder.findAxes(Polygon<double>{ nodes }, 6) };
+    ASSERT_EQ(axes.size(), 6u);
+    for (const auto& axis : axes) {
+        EXPECT_LT(axis.rmsError, 1e-6);
+        EXPECT_LT(axis.maxError, 1e-6);
+    }
+}
+
+TEST(ApproximateTest, AxesBetweenSamples) {
+    // ends of axes of rectangle are not on grid of coarse samples
+    Polygon<double> poly { { { 0, 0 }, { 4, 0 }, { 4, 2 }, { 0, 2 } } };
+    ApproximateSymmetry<double> finder{};
+    auto axes { finder.findAxes(poly, 2) };
+    ASSERT_EQ(axes.size(), 2u);
+    EXPECT_LT(axes[1].rmsError, 1e-6);
+    Axis<double> vertical { Point2<double>(2, 0), Point2<double>(2, 2) }, horizontal { Point2<double>(0, 1), Point2<double>(4, 1) };
+    EXPECT_TRUE(vertical.isEqual(axes[0].axis, 1e-6) || horizontal.isEqual(axes[0].axis, 1e-6));
+}
+
+TEST(ApproximateTest, NoisyEllipse) {
+    ApproximateSymmetry<double> finder{};
+    auto axes { finder.findAxes(ellipse(20000, 4, 2, 2e-4), 2) };
+    ASSERT_EQ(axes.size(), 2u);
+
+    // both axes of ellipse, error is of order of noise that is less than distance between nodes
+    double pi { std::acos(-1) };
+    double first { getAngle(axes[0].axis) }, second { getAngle(axes[1].axis) };
+    EXPECT_NEAR(std::fabs(first - second), pi / 2, 1e-2);
+    EXPECT_TRUE(std::fabs(first) < 1e-2 || std::fabs(first - pi) < 1e-2 || std::fabs(first - pi / 2) < 1e-2);
+    EXPECT_LT(axes[0].rmsError, 1e-3);
+    EXPECT_LT(axes[0].maxError, 5e-3);
+    EXPECT_LE(axes[0].rmsError, axes[1].rmsError);
+}
+
+TEST(ApproximateTest, AsymmetricShapeHasLargeError) {
+    Polygon<double> poly { { { 0, 0 }, { 10, 0 }, { 7, 1 }, { 2, 6 } } };
+    ApproximateSymmetry<double> finder{};
+    auto axes { finder.findAxes(poly, 1) };
+    ASSERT_EQ(axes.size(), 1u);
+    EXPECT_GT(axes[0].rmsError, 0.3);
+    EXPECT_GE(axes[0].maxError, axes[0].rmsError);
+}
+
+TEST(ApproximateTest, DegeneratePolygons) {
+    ApproximateSymmetry<double> finder{};
+    EXPECT_TRUE(finder.findAxes(Polygon<double>{ { { 0, 0 }, { 1, 1 } } }, 4).empty());
+    EXPECT_TRUE(finder.findAxes(Polygon<double>{ { { 1, 1 }, { 1, 1 }, { 1, 1 } } }, 4).empty());
+    EXPECT_TRUE(finder.findAxes(ellipse(10, 1, 1, 0), 0).empty());
+}
+
+TEST(ApproximateTest, AxisNearNodeZero) {
+    // rectangle starts with extra node just before middle of bottom edge, so best shift of
+    // vertical axis is 0 and its end is between shifts -1 and 1
+    Polygon<double> poly { { { 1.99, 0 }, { 4, 0 }, { 4, 2 }, { 0, 2 }, { 0, 0 } } };
+    ApproximateSymmetry<double> finder{};
+    auto axes { finder.findAxes(poly, 2) };
+    ASSERT_EQ(axes.size(), 2u);
+    Axis<double> vertical { Point2<double>(2, 0), Point2<double>(2, 2) };
+    auto found { std::find_if(axes.begin(), axes.end(), [&](ApproximateAxis<double>& axis) { return vertical.isEqual(axis.axis, 1e-6); }) };
+    ASSERT_NE(found, axes.end());
+    EXPECT_NEAR(getAngle(found->axis), std::acos(-1) / 2, 1e-6);
+    EXPECT_LT(found->rmsError, 1e-6);
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "Point2.hpp"
+#include "Axis.hpp"
+#include "AxisWriter.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static std::vector<Axis<double>> randomAxes(std::mt19937& gen, size_t count) {
+    std::uniform_real_distribution<double> mantissa(-1, 1);
+    std::uniform_int_distribution<int> exponent(-14, 13);
+    auto value = [&] { return mantissa(gen) * std::pow(10.0, exponent(gen)); };
+    std::vector<Axis<double>> axes{};
+    for (size_t i{}; i < count; ++i) {
+        axes.push_back(Axis<double>(Point2<double>(value(), value()), Point2<double>(value(), value())));
+    }
+    return axes;
+}
+
+TEST(AxisWriterTest, TextIsSameAsToString) {
+    std::mt19937 gen(9);
+    std::ostringstream out{}, expected{};
+    {
+        // small buffer is written many times before flush
+        AxisWriter writer { out, AxisFormat::Text, 100 };
+        for (size_t i{}; i < 200; ++i) {
+            auto axes { randomAxes(gen, i % 4) };
+            if (i == 7) {
+                axes.push_back(Axis<double>(Point2<double>(-0.0, 0.5), Point2<double>(1e12, -2.5e-7)));
+            }
+            std::string label { i == 0 ? "" : "file.txt[" + std::to_string(i) + "]" };
+            writer.write(label, axes);
+
+            if (!label.empty()) {
+                expected << label << ":\n";
+            }
+            if (axes.empty()) {
+                expected << "non-symmetric\n";
+            }
+            for (const auto& axis : axes) {
+                expected << axis.toString() << "\n";
+            }
+        }
+        writer.flush();
+    }
+    EXPECT_EQ(out.str(), expected.str());
+}
+
+TEST(AxisWriterTest, JsonLinesAreReadBackExactly) {
+    std::mt19937 gen(10);
+    auto axes { randomAxes(gen, 3) };
+    std::ostringstream out{};
+    {
+        AxisWriter writer { out, AxisFormat::Json };
+        writer.write("a \"quoted\"\\name\n", axes);
+        writer.write("empty", std::vector<Axis<double>>{});
+    }
+    std::istringstream in { out.str() };
+    std::string line{};
+    std::getline(in, line);
+    std::string prefix { "{\"label\":\"a \\\"quoted\\\"\\\\name\\u000a\",\"axes\":[[" };
+    ASSERT_EQ(line.substr(0, prefix.size()), prefix);
+
+    const char* c { line.c_str() + prefix.size() };
+    for (const auto& axis : axes) {
+        double values[] { axis.getStart().x, axis.getStart().y, axis.getEnd().x, axis.getEnd().y };
+        for (double value : values) {
+            char* end{};
+            EXPECT_EQ(std::strtod(c, &end), value);
+            c = end + 1;
+        }
+        c += 2;
+    }
+    std::getline(in, line);
+    EXPECT_EQ(line, "{\"label\":\"empty\",\"axes\":[]}");
+}
+
+TEST(AxisWriterTest, JsonNonFiniteIsNull) {
+    std::vector<Axis<double>> axes { Axis<double>(Point2<double>(NAN, INFINITY), Point2<double>(-INFINITY, 0.5)) };
+    std::ostringstream out{};
+    {
+        AxisWriter writer { out, AxisFormat::Json };
+        writer.write("bad", axes);
+    }
+    EXPECT_EQ(out.str(), "{\"label\":\"bad\",\"axes\":[[null,null,null,0.5]]}\n");
+}
+
+TEST(AxisWriterTest, BinaryRecords) {
+    std::mt19937 gen(11);
+    std::vector<std::vector<Axis<double>>> polygons { randomAxes(gen, 2), {}, randomAxes(gen, 5) };
+    std::ostringstream out{};
+    AxisWriter writer { out, AxisFormat::Binary };
+    for (size_t i{}; i < polygons.size(); ++i) {
+        writer.write("p" + std::to_string(i), polygons[i]);
+    }
+    writer.flush();
+
+    auto data { out.str() };
+    AxisStreamHeader header{};
+    ASSERT_GE(data.size(), sizeof(header));
+    std::memcpy(&header, data.data(), sizeof(header));
+    EXPECT_EQ(std::memcmp(header.magic, AxisStreamHeader::kMagic, sizeof(header.magic)), 0);
+    EXPECT_EQ(header.byteOrder, AxisStreamHeader::kByteOrder);
+
+    size_t offset { sizeof(header) };
+    for (size_t i{}; i < polygons.size(); ++i) {
+        uint32_t sizes[2]{};
+        std::memcpy(sizes, data.data() + offset, sizeof(sizes));
+        offset += sizeof(sizes);
+        EXPECT_EQ(data.substr(offset, sizes[0]), "p" + std::to_string(i));
+        offset += sizes[0];
+        ASSERT_EQ(sizes[1], polygons[i].size());
+        for (const auto& axis : polygons[i]) {
+            double coords[4]{};
+            std::memcpy(coords, data.data() + offset, sizeof(coords));
+            offset += sizeof(coords);
+            EXPECT_EQ(coords[0], axis.getStart().x);
+            EXPECT_EQ(coords[1], axis.getStart().y);
+            EXPECT_EQ(coords[2], axis.getEnd().x);
+            EXPECT_EQ(coords[3], axis.getEnd().y);
+        }
+    }
+    EXPECT_EQ(offset, data.size());
+}
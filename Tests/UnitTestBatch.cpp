@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include "Axis.hpp"
+#include "SymmetryFinder.hpp"
+#include "ThreadPool.hpp"
+#include "TestHelpers.hpp"
+
+#include <atomic>
+#include <vector>
+
+constexpr double epsilon{ 1e-6 };
+
+TEST(ThreadPoolTest, ParallelForVisitsEveryIndex) {
+    ThreadPool pool{ 4 };
+    std::vector<int> visits(10000);
+    pool.parallelFor(visits.size(), 7, [&](size_t i) { ++visits[i]; });
+    for (auto count : visits) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(ThreadPoolTest, NestedParallelFor) {
+    ThreadPool pool{ 2 };
+    std::atomic<size_t> sum{};
+    pool.parallelFor(16, 1, [&](size_t) {
+        pool.parallelFor(100, 10, [&](size_t j) { sum += j; });
+    });
+    EXPECT_EQ(sum, 16 * 4950);
+}
+
+TEST(ThreadPoolTest, RethrowException) {
+    ThreadPool pool{ 2 };
+    EXPECT_THROW(pool.parallelFor(100, 1, [](size_t i) {
+        if (i == 42) {
+            throw std::runtime_error("error");
+        }
+    }), std::runtime_error);
+}
+
+TEST(BatchTest, ResultsInInputOrder) {
+    std::vector<Polygon<double>> polygons{};
+    for (int i{}; i < 200; ++i) {
+        polygons.push_back(regularPolygon(3 + i % 17, 1.0 + i));
+    }
+    polygons.push_back(Polygon<double>{ std::vector<Point2<double>>{ {0,0}, {2,0}, {2.5,1}, {0.5,1} } });
+
+    ThreadPool pool{ 4 };
+    SymmetryFinder<double> finder{};
+    finder.setThreadPool(&pool);
+    auto results { finder.findSymmetryBatch(polygons, epsilon) };
+
+    ASSERT_EQ(results.size(), polygons.size());
+    for (size_t i{}; i + 1 < polygons.size(); ++i) {
+        EXPECT_EQ(results[i].size(), 3 + i % 17);
+    }
+    EXPECT_TRUE(results.back().empty());
+}
+
+TEST(BatchTest, EmptyBatch) {
+    SymmetryFinder<double> finder{};
+    std::vector<Polygon<double>> polygons{};
+    EXPECT_TRUE(finder.findSymmetryBatch(polygons, epsilon).empty());
+}
+
+TEST(ParallelCandidatesTest, SameAsSerial) {
+    ThreadPool pool{ 4 };
+    SymmetryFinder<double> serial{ SymmetryEngine::Reference };
+    SymmetryFinder<double> parallel{ SymmetryEngine::Reference };
+    parallel.setThreadPool(&pool);
+    parallel.setParallelism(3, 0);
+
+    for (int size : { 5, 12, 64, 101 }) {
+        auto poly { regularPolygon(size, 2.0) };
+        auto expected { serial.findSymmetry(poly, epsilon) };
+        auto result { parallel.findSymmetry(poly, epsilon) };
+        ASSERT_EQ(expected.size(), result.size());
+        for (size_t i{}; i < result.size(); ++i) {
+            EXPECT_TRUE(expected[i].isEqual(result[i], epsilon));
+        }
+    }
+}
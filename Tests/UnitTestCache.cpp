@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include "SymmetryFinder.hpp"
+#include "SymmetryCache.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// arrow with one axis y = 0, nodes start away from axis
+static std::vector<Point2<double>> arrow() {
+    return { {1, 1}, {0, 1}, {0, 2}, {-2, 0}, {0, -2}, {0, -1}, {1, -1} };
+}
+
+// rotate by angle, move by (dx, dy), start from node shift, optionally reverse order and mirror
+static Polygon<double> transform(std::vector<Point2<double>> nodes, double angle, double dx, double dy,
+                                 size_t shift, bool reverse, bool mirror) {
+    for (auto& node : nodes) {
+        double y { mirror ? -node.y : node.y };
+        node = Point2<double>(node.x * std::cos(angle) - y * std::sin(angle) + dx,
+                              node.x * std::sin(angle) + y * std::cos(angle) + dy);
+    }
+    std::rotate(nodes.begin(), nodes.begin() + shift % nodes.size(), nodes.end());
+    if (reverse) {
+        std::reverse(nodes.begin(), nodes.end());
+    }
+    return Polygon<double>{ nodes };
+}
+
+static bool sameAxes(std::vector<Axis<double>> a, std::vector<Axis<double>> b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (auto& axis : a) {
+        if (std::none_of(b.begin(), b.end(), [&](Axis<double>& other) { return axis.isEqual(other, 1e-9); })) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST(CacheTest, CongruentCopiesHit) {
+    SymmetryCache<double> cache{};
+    SymmetryFinder<double> finder{};
+    auto first { transform(arrow(), 0, 0, 0, 0, false, false) };
+    EXPECT_TRUE(sameAxes(cache.findSymmetry(first, 1e-8), finder.findSymmetry(first, 1e-8)));
+    EXPECT_EQ(cache.getMisses(), 1);
+
+    size_t queries{};
+    for (double angle : { 0.0, 0.7, 2.5 }) {
+        for (size_t shift : { 0, 3, 6 }) {
+            for (int variant{}; variant < 4; ++variant) {
+                auto copy { transform(arrow(), angle, 100.5, -3.25, shift, variant / 2 == 1, variant % 2 == 1) };
+                auto axes { cache.findSymmetry(copy, 1e-8) };
+                ASSERT_EQ(axes.size(), 1);
+                EXPECT_TRUE(sameAxes(axes, finder.findSymmetry(copy, 1e-8))) << angle << " " << shift << " " << variant;
+                ++queries;
+            }
+        }
+    }
+    EXPECT_EQ(cache.getHits(), queries);
+    EXPECT_EQ(cache.getMisses(), 1);
+    EXPECT_EQ(cache.getCollisions(), 0);
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(CacheTest, AsymmetricCopiesHit) {
+    // pentagon without axes, so reversed order of nodes can not be taken for mirror image
+    std::vector<Point2<double>> pentagon { {0, 0}, {4, 0}, {5, 2}, {2, 4}, {-1, 1} };
+    SymmetryCache<double> cache{};
+    EXPECT_TRUE(cache.findSymmetry(Polygon<double>{ pentagon }, 1e-8).empty());
+
+    size_t queries{};
+    for (size_t shift : { 0, 2 }) {
+        for (int variant{}; variant < 4; ++variant) {
+            auto copy { transform(pentagon, 1.1, -4, 9, shift, variant / 2 == 1, variant % 2 == 1) };
+            EXPECT_TRUE(cache.findSymmetry(copy, 1e-8).empty());
+            ++queries;
+        }
+    }
+    auto reversed { pentagon };
+    std::reverse(reversed.begin(), reversed.end());
+    EXPECT_TRUE(cache.findSymmetry(Polygon<double>{ reversed }, 1e-8).empty());
+    ++queries;
+
+    EXPECT_EQ(cache.getHits(), queries);
+    EXPECT_EQ(cache.getMisses(), 1);
+    EXPECT_EQ(cache.getCollisions(), 0);
+}
+
+TEST(CacheTest, RegularPolygonAxesAreMapped) {
+    std::vector<Point2<double>> nodes{};
+    for (size_t i{}; i < 12; ++i) {
+        double angle { 2 * std::acos(-1) * i / 12 };
+        nodes.push_back(Point2<double>(3 * std::cos(angle), 3 * std::sin(angle)));
+    }
+    SymmetryCache<double> cache{};
+    SymmetryFinder<double> finder{};
+    cache.findSymmetry(Polygon<double>{ nodes }, 1e-8);
+    auto copy { transform(nodes, 0.3, -7, 2, 5, true, false) };
+    EXPECT_TRUE(sameAxes(cache.findSymmetry(copy, 1e-8), finder.findSymmetry(copy, 1e-8)));
+    EXPECT_EQ(cache.getHits(), 1);
+}
+
+TEST(CacheTest, OtherShapesMissAndLeastRecentIsEvicted) {
+    SymmetryCache<double> cache{ 2 };
+    auto a { transform(arrow(), 0, 0, 0, 0, false, false) };
+    Polygon<double> b { std::vector<Point2<double>>{ {0, 0}, {2, 0}, {2, 1}, {0, 1} } };
+    Polygon<double> c { std::vector<Point2<double>>{ {0, 0}, {3, 0}, {1, 2} } };
+    cache.findSymmetry(a, 1e-8);
+    cache.findSymmetry(b, 1e-8);
+    cache.findSymmetry(a, 1e-8);
+    cache.findSymmetry(c, 1e-8);
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.getHits(), 1);
+    EXPECT_EQ(cache.getMisses(), 3);
+
+    // b was least recently used
+    cache.findSymmetry(a, 1e-8);
+    cache.findSymmetry(b, 1e-8);
+    EXPECT_EQ(cache.getHits(), 2);
+    EXPECT_EQ(cache.getMisses(), 4);
+
+    // other epsilon is other key
+    cache.findSymmetry(b, 1e-6);
+    EXPECT_EQ(cache.getMisses(), 5);
+}
+
+TEST(CacheTest, CollisionIsVerified) {
+    // coarse quantization gives the same key to slightly different shapes
+    SymmetryCache<double> cache{ 16, 0.1 };
+    SymmetryFinder<double> finder{};
+    Polygon<double> kite { std::vector<Point2<double>>{ {0, 0}, {1, 1}, {3, 0}, {1, -1} } };
+    Polygon<double> skewed { std::vector<Point2<double>>{ {0, 0}, {1, 1.01}, {3, 0}, {1, -1} } };
+    cache.findSymmetry(kite, 1e-8);
+    auto axes { cache.findSymmetry(skewed, 1e-8) };
+    EXPECT_EQ(cache.getCollisions(), 1);
+    EXPECT_EQ(cache.getHits(), 0);
+    EXPECT_TRUE(sameAxes(axes, finder.findSymmetry(skewed, 1e-8)));
+}
+
+TEST(CacheTest, IntegerPolygons) {
+    SymmetryCache<int64_t> cache{};
+    Polygon<int64_t> a { std::vector<Point2<int64_t>>{ {0, 0}, {4, 0}, {4, 2}, {2, 3}, {0, 2} } };
+    // rotated by 90 degrees, moved and started from other node
+    Polygon<int64_t> b { std::vector<Point2<int64_t>>{ {10, 14}, {9, 12}, {10, 10}, {12, 10}, {12, 14} } };
+    auto expected { cache.findSymmetry(a, 0) };
+    ASSERT_EQ(expected.size(), 1);
+    auto axes { cache.findSymmetry(b, 0) };
+    EXPECT_EQ(cache.getHits(), 1);
+    ASSERT_EQ(axes.size(), 1);
+    Axis<double> axis { Point2<double>(12, 12), Point2<double>(9, 12) };
+    EXPECT_TRUE(axes[0].isEqual(axis, 1e-12));
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include "CompactAxis.hpp"
+#include "SymmetryFinder.hpp"
+#include "TestHelpers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+static std::vector<std::pair<uint32_t, uint32_t>> normalize(const std::vector<CompactAxis>& axes) {
+    std::vector<std::pair<uint32_t, uint32_t>> result{};
+    for (const auto& axis : axes) {
+        result.push_back(std::minmax(axis.first, axis.second));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+TEST(CompactAxisTest, Size) {
+    EXPECT_LT(sizeof(CompactAxis), sizeof(Axis<double>));
+}
+
+TEST(CompactAxisTest, EnginesGiveSameElements) {
+    SymmetryFinder<double> linear{}, reference{ SymmetryEngine::Reference }, vectorized{ SymmetryEngine::Vectorized };
+    for (size_t size : { 3, 4, 5, 8, 9, 64, 101 }) {
+        for (double radius : { 1e-6, 3.0, 1e3 }) {
+            auto poly { regularPolygon(size, radius) };
+            auto expected { normalize(linear.findSymmetryCompact(poly, 1e-8)) };
+            ASSERT_EQ(expected.size(), size);
+            // every axis is found once, pairwise merge of Reference engine compares cross product
+            // with absolute epsilon, so all candidates of tiny polygon are on one line for it
+            if (radius > 1) {
+                EXPECT_EQ(normalize(reference.findSymmetryCompact(poly, 1e-8)), expected);
+            }
+            EXPECT_EQ(normalize(vectorized.findSymmetryCompact(poly, 1e-8)), expected);
+        }
+    }
+}
+
+TEST(CompactAxisTest, EndpointsAreBuiltFromNodes) {
+    Polygon<double> square { std::vector<Point2<double>>{ {0,0}, {2,0}, {2,2}, {0,2} } };
+    SymmetryFinder<double> finder{};
+    auto compact { finder.findSymmetryCompact(square, 1e-8) };
+    auto axes { SymmetryFinder<double>::toAxes(square.getNodes(), compact) };
+    ASSERT_EQ(axes.size(), 4);
+    Axis<double> vertical { Point2<double>(1, 0), Point2<double>(1, 2) };
+    EXPECT_TRUE(std::any_of(axes.begin(), axes.end(), [&](Axis<double>& axis) { return axis.isEqual(vertical, 1e-12); }));
+}
+
+TEST(CompactAxisTest, NearCenterCandidatesAreOneAxis) {
+    // small butterfly with notches near center, top notch is moved less than epsilon,
+    // so its angle differs from bottom notch by about 1e-4 that is much more than epsilon
+    double s { 1e-3 };
+    Polygon<double> butterfly { std::vector<Point2<double>>{ {3e-8, 0.3 * s}, {-s, s}, {-s, -s}, {0, -0.3 * s}, {s, -s}, {s, s} } };
+    SymmetryFinder<double> finder{ SymmetryEngine::Vectorized };
+    std::vector<std::pair<uint32_t, uint32_t>> expected { { 0, 6 }, { 3, 9 } };
+    EXPECT_EQ(normalize(finder.findSymmetryCompact(butterfly, 1e-6)), expected);
+}
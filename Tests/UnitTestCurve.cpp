@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include "Fft.hpp"
+#include "CurveSymmetry.hpp"
+#include "SymmetryFinder.hpp"
+#include "TestHelpers.hpp"
+
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+/// <summary>
+/// Curve r(t) = 1 + a cos(3t) + b sin(2t + 0.5) sampled with irregular spacing of nodes
+/// </summary>
+static Polygon<double> curve(size_t size, double a, double b, double rotation = 0) {
+    double pi { std::acos(-1) };
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> jitter(-0.3, 0.3);
+    std::vector<Point2<double>> nodes{};
+    for (size_t i{}; i < size; ++i) {
+        double t { 2 * pi * (i + jitter(gen)) / size };
+        t += 0.2 * std::sin(t);
+        double r { 1 + a * std::cos(3 * t) + b * std::sin(2 * t + 0.5) };
+        nodes.push_back(Point2<double>(r * std::cos(t + rotation), r * std::sin(t + rotation)));
+    }
+    return Polygon<double>{ nodes };
+}
+
+TEST(FftTest, MatchesDft) {
+    std::vector<std::complex<double>> values{}, expected(16);
+    for (size_t i{}; i < 16; ++i) {
+        values.push_back({ std::sin(i * 0.7), std::cos(i * 1.3) });
+    }
+    for (size_t k{}; k < 16; ++k) {
+        for (size_t j{}; j < 16; ++j) {
+            expected[k] += values[j] * std::polar(1.0, -2 * std::acos(-1) * j * k / 16);
+        }
+    }
+    auto transformed { values };
+    fft(transformed);
+    for (size_t k{}; k < 16; ++k) {
+        EXPECT_NEAR(std::abs(transformed[k] - expected[k]), 0, 1e-9);
+    }
+    fft(transformed, true);
+    for (size_t k{}; k < 16; ++k) {
+        EXPECT_NEAR(std::abs(transformed[k] - values[k]), 0, 1e-12);
+    }
+    std::vector<std::complex<double>> odd(12);
+    EXPECT_THROW(fft(odd), std::runtime_error);
+}
+
+TEST(CurveTest, IrregularlySampledCurve) {
+    double pi { std::acos(-1) };
+    auto poly { curve(5000, 0.3, 0, 0.25) };
+
+    // nodes are not symmetric, only the curve is
+    EXPECT_TRUE(SymmetryFinder<double>{}.findSymmetry(poly, 1e-8).empty());
+
+    CurveSymmetry<double> finder{};
+    auto axes { finder.findSymmetry(poly, 1e-3) };
+    ASSERT_EQ(axes.size(), 3u);
+    for (const auto& axis : axes) {
+        double angle { std::fmod(getAngle(axis) - 0.25 + pi, pi / 3) };
+        EXPECT_TRUE(angle < 1e-3 || angle > pi / 3 - 1e-3);
+    }
+}
+
+TEST(CurveTest, WithoutRefinement) {
+    CurveSymmetry<double> finder { 4096 };
+    finder.setRefine(false);
+    EXPECT_EQ(finder.getSampleCount(), 4096u);
+    EXPECT_EQ(finder.findSymmetry(curve(5000, 0.3, 0), 2e-2).size(), 3u);
+}
+
+TEST(CurveTest, RefineOnlyBestPeaks) {
+    // all 256 axes of regular polygon are exact shifts of 1024 samples
+    CurveSymmetry<double> finder{};
+    finder.setRefineCount(8);
+    EXPECT_EQ(finder.getRefineCount(), 8u);
+    EXPECT_EQ(finder.findSymmetry(regularPolygon(256, 2.0), 1e-3).size(), 256u);
+
+    // without refined peaks result is the same as without refinement
+    CurveSymmetry<double> sampled{};
+    sampled.setRefine(false);
+    finder.setRefineCount(0);
+    auto poly { curve(5000, 0.3, 0) };
+    EXPECT_EQ(finder.findSymmetry(poly, 1e-3).size(), sampled.findSymmetry(poly, 1e-3).size());
+}
+
+TEST(CurveTest, AsymmetricCurve) {
+    CurveSymmetry<double> finder{};
+    EXPECT_TRUE(finder.findSymmetry(curve(5000, 0.3, 0.2), 1e-3).empty());
+}
+
+TEST(CurveTest, SampleCountIsPowerOfTwo) {
+    CurveSymmetry<double> finder { 1000 };
+    EXPECT_EQ(finder.getSampleCount(), 1024u);
+    finder.setSampleCount(3);
+    EXPECT_EQ(finder.getSampleCount(), 16u);
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include "Axis.hpp"
+#include "SymmetryFinder.hpp"
+#include "TestHelpers.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+static Polygon<int64_t> toInteger(const Polygon<double>& p) {
+    std::vector<Point2<int64_t>> nodes{};
+    for (const auto& node : p.getNodes()) {
+        nodes.push_back(Point2<int64_t>(static_cast<int64_t>(node.x), static_cast<int64_t>(node.y)));
+    }
+    return Polygon<int64_t>{ nodes };
+}
+
+TEST(ExactIntegerTest, SquareAndRoof) {
+    Polygon<int64_t> square { std::vector<Point2<int64_t>>{ {0,0}, {1,0}, {1,1}, {0,1} } };
+    SymmetryFinder<int64_t> finder{};
+    std::vector<Axis<double>> axes
+    {
+       { Point2<double>(0,0),   Point2<double>(1,1) },
+       { Point2<double>(1,0),   Point2<double>(0,1) },
+       { Point2<double>(0.5,0), Point2<double>(0.5,1) },
+       { Point2<double>(0,0.5), Point2<double>(1,0.5) },
+    };
+    auto result { finder.findSymmetry(square, 0) };
+    EXPECT_TRUE(compareAxes(axes, result, 1e-9));
+
+    Polygon<int64_t> roof { std::vector<Point2<int64_t>>{ {0,0}, {4,0}, {4,3}, {2,5}, {0,3} } };
+    EXPECT_EQ(finder.findSymmetry(roof, 0).size(), 1);
+    EXPECT_EQ(finder.findSymmetryGroup(roof, 0).rotationOrder, 1);
+}
+
+TEST(ExactIntegerTest, NoEpsilon) {
+    // difference of 1 in 2^30 is not lost
+    const int64_t big { int64_t(1) << 30 };
+    Polygon<int64_t> almost { std::vector<Point2<int64_t>>{ {-big,-big}, {big,-big}, {big,big}, {-big + 1,big} } };
+    SymmetryFinder<int64_t> finder{};
+    EXPECT_EQ(finder.findSymmetry(almost, 1e-3).size(), 0);
+
+    Polygon<int64_t> square { std::vector<Point2<int64_t>>{ {-big,-big}, {big,-big}, {big,big}, {-big,big} } };
+    EXPECT_EQ(finder.findSymmetry(square, 0).size(), 4);
+
+    Polygon<int64_t> tooBig { std::vector<Point2<int64_t>>{ {0,0}, {2 * big,0}, {0,1} } };
+    EXPECT_THROW(finder.findSymmetry(tooBig, 0), std::runtime_error);
+}
+
+TEST(ExactIntegerTest, SameAsDouble) {
+    std::mt19937 gen(3);
+    std::uniform_int_distribution<int> coord(-1000, 1000);
+    SymmetryFinder<int64_t> exact{};
+    SymmetryFinder<double> reference{ SymmetryEngine::Reference };
+    for (int i{}; i < 20; ++i) {
+        // lattice polygon mirrored by y axis
+        std::vector<Point2<double>> nodes{};
+        int half { 3 + i % 5 };
+        for (int k{}; k < half; ++k) {
+            nodes.push_back(Point2<double>(std::abs(coord(gen)) + 1, coord(gen)));
+        }
+        std::sort(nodes.begin(), nodes.end(), [](auto& a, auto& b) { return a.y < b.y; });
+        for (int k{ half - 1 }; k >= 0; --k) {
+            nodes.push_back(Point2<double>(-nodes[k].x, nodes[k].y));
+        }
+        Polygon<double> poly { nodes };
+        auto expected { reference.findSymmetry(poly, 1e-9) };
+        auto result { exact.findSymmetry(toInteger(poly), 0) };
+        EXPECT_TRUE(compareAxes(expected, result, 1e-9));
+    }
+}
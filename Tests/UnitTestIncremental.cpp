@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include "Axis.hpp"
+#include "IncrementalSymmetry.hpp"
+#include "SymmetryFinder.hpp"
+#include "TestHelpers.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+template <class T>
+static void expectSameAxes(const IncrementalSymmetry<T>& incremental, double epsilon) {
+    SymmetryFinder<T> finder{};
+    finder.setSimplifyThreshold(SIZE_MAX);
+    auto expected { finder.findSymmetry(incremental.getPolygon(), epsilon) };
+    const auto& axes { incremental.getAxes() };
+    ASSERT_EQ(axes.size(), expected.size());
+    for (size_t i{}; i < axes.size(); ++i) {
+        EXPECT_EQ(axes[i].toString(), expected[i].toString());
+    }
+}
+
+TEST(IncrementalTest, MoveBreaksAndRestoresSymmetry) {
+    IncrementalSymmetry<double> incremental { regularPolygon(6, 1), 1e-8 };
+    EXPECT_EQ(incremental.getAxes().size(), 6);
+
+    auto node { incremental.getPolygon().getNodes()[0] };
+    incremental.moveNode(0, Point2<double>(2, 0));
+    // only axis through moved node and opposite node is left
+    EXPECT_EQ(incremental.getAxes().size(), 1);
+    expectSameAxes(incremental, 1e-8);
+
+    incremental.moveNode(0, node);
+    EXPECT_EQ(incremental.getAxes().size(), 6);
+    expectSameAxes(incremental, 1e-8);
+}
+
+TEST(IncrementalTest, InsertAndErase) {
+    Polygon<double> square { std::vector<Point2<double>>{ {0,0}, {1,0}, {1,1}, {0,1} } };
+    IncrementalSymmetry<double> incremental { square, 1e-8 };
+    EXPECT_EQ(incremental.getAxes().size(), 4);
+
+    // roof over top edge keeps one axis
+    incremental.insertNode(3, Point2<double>(0.5, 2));
+    EXPECT_EQ(incremental.getAxes().size(), 1);
+    expectSameAxes(incremental, 1e-8);
+
+    incremental.eraseNode(3);
+    EXPECT_EQ(incremental.getAxes().size(), 4);
+    expectSameAxes(incremental, 1e-8);
+
+    incremental.insertNode(4, Point2<double>(-1, 0.5));
+    expectSameAxes(incremental, 1e-8);
+
+    incremental.eraseNode(0);
+    incremental.eraseNode(0);
+    incremental.eraseNode(0);
+    EXPECT_TRUE(incremental.getAxes().empty());
+    EXPECT_THROW(incremental.eraseNode(5), std::runtime_error);
+}
+
+TEST(IncrementalTest, RandomEdits) {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> edit(0, 2);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    IncrementalSymmetry<double> incremental { regularPolygon(8, 1), 1e-8 };
+
+    for (int i{}; i < 300; ++i) {
+        auto size { incremental.getPolygon().getNodes().size() };
+        auto index { std::uniform_int_distribution<size_t>(0, size - 1)(gen) };
+        int kind { edit(gen) };
+        if (kind == 0 || (kind == 2 && size <= 3)) {
+            // mirror of other node keeps symmetry often
+            auto other { incremental.getPolygon().getNodes()[(size - index) % size] };
+            incremental.moveNode(index, gen() % 2 == 0 ? Point2<double>(other.x, -other.y) : Point2<double>(coord(gen), coord(gen)));
+        } else if (kind == 1) {
+            incremental.insertNode(index, Point2<double>(coord(gen), coord(gen)));
+        } else {
+            incremental.eraseNode(index);
+        }
+        expectSameAxes(incremental, 1e-8);
+    }
+}
+
+TEST(IncrementalTest, MovesAreCheckedLocally) {
+    auto poly { regularPolygon(64, 1) };
+    IncrementalSymmetry<double> incremental { poly, 1e-8 };
+    EXPECT_EQ(incremental.getAxes().size(), 64);
+    EXPECT_EQ(incremental.getRecomputeCount(), 1);
+
+    // moved node has no mirror, all axes break without full recompute
+    incremental.moveNode(5, Point2<double>(0.3, 0.4));
+    EXPECT_TRUE(incremental.getAxes().empty());
+    EXPECT_EQ(incremental.getRecomputeCount(), 1);
+    expectSameAxes(incremental, 1e-8);
+
+    // restored node has mirrors again, so axis set can grow
+    incremental.moveNode(5, poly.getNodes()[5]);
+    EXPECT_EQ(incremental.getAxes().size(), 64);
+    EXPECT_EQ(incremental.getRecomputeCount(), 2);
+
+    // node moved along its axis keeps only this axis
+    incremental.moveNode(5, poly.getNodes()[5] * 1.5);
+    EXPECT_EQ(incremental.getAxes().size(), 1);
+    EXPECT_EQ(incremental.getRecomputeCount(), 2);
+    expectSameAxes(incremental, 1e-8);
+
+    // node off axis keeps the axis when it is moved together with its mirror
+    auto node { poly.getNodes()[9] }, mirror { poly.getNodes()[1] };
+    incremental.moveNode(9, node * 0.8);
+    EXPECT_TRUE(incremental.getAxes().empty());
+    incremental.moveNode(1, mirror * 0.8);
+    EXPECT_EQ(incremental.getAxes().size(), 1);
+    expectSameAxes(incremental, 1e-8);
+}
+
+TEST(IncrementalTest, RandomMirroredMoves) {
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    IncrementalSymmetry<double> incremental { regularPolygon(40, 1), 1e-8 };
+
+    // nodes are moved in mirrored pairs of axis through node 0, so the axis and other axes come and go
+    for (int i{}; i < 300; ++i) {
+        auto index { std::uniform_int_distribution<size_t>(0, 39)(gen) };
+        Point2<double> p { coord(gen), coord(gen) };
+        incremental.moveNode(index, p);
+        expectSameAxes(incremental, 1e-8);
+        if (gen() % 4 != 0) {
+            incremental.moveNode((40 - index) % 40, Point2<double>(p.x, -p.y));
+            expectSameAxes(incremental, 1e-8);
+        }
+    }
+    EXPECT_LT(incremental.getRecomputeCount(), 300);
+}
+
+TEST(IncrementalTest, IntegerCoords) {
+    Polygon<int64_t> square { std::vector<Point2<int64_t>>{ {0,0}, {2,0}, {2,2}, {0,2} } };
+    IncrementalSymmetry<int64_t> incremental { square, 0 };
+    EXPECT_EQ(incremental.getAxes().size(), 4);
+    expectSameAxes(incremental, 0);
+
+    // middle of edge is half-integer
+    incremental.moveNode(2, Point2<int64_t>(3, 2));
+    ASSERT_EQ(incremental.getAxes().size(), 0);
+    incremental.moveNode(3, Point2<int64_t>(-1, 2));
+    ASSERT_EQ(incremental.getAxes().size(), 1);
+    EXPECT_TRUE(incremental.getAxes()[0].getStart().isEqual(Point2<double>(1, 0), 0) ||
+                incremental.getAxes()[0].getEnd().isEqual(Point2<double>(1, 0), 0));
+    expectSameAxes(incremental, 0);
+}
+
+TEST(IncrementalTest, LargePolygonIsNotSimplified) {
+    // square with 5000 nodes on bottom edge and one node on other edges: without
+    // simplification only axis through middle of bottom edge and top edge is left
+    std::vector<Point2<double>> nodes{};
+    for (size_t i{}; i < 5000; ++i) {
+        nodes.push_back(Point2<double>(2.0 * i / 5000, 0));
+    }
+    nodes.push_back(Point2<double>(2, 0));
+    nodes.push_back(Point2<double>(2, 2));
+    nodes.push_back(Point2<double>(0, 2));
+    IncrementalSymmetry<double> incremental { Polygon<double>{ nodes }, 1e-8 };
+    EXPECT_EQ(incremental.getAxes().size(), 1);
+    expectSameAxes(incremental, 1e-8);
+
+    incremental.moveNode(0, Point2<double>(-1e-3, 0));
+    EXPECT_TRUE(incremental.getAxes().empty());
+    expectSameAxes(incremental, 1e-8);
+}
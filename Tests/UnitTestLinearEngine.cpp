@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include "Axis.hpp"
+#include "SymmetryFinder.hpp"
+#include "TestHelpers.hpp"
+
+#include <vector>
+#include <random>
+
+constexpr double epsilon{ 1e-6 };
+// star-shaped polygon that is symmetric relative to x axis
+static Polygon<double> mirroredPolygon(int half, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> radius(1.0, 2.0);
+    std::vector<double> angles{};
+    for (int i{ 1 }; i <= half; ++i) {
+        angles.push_back(std::acos(-1) * i / (half + 1));
+    }
+    std::vector<Point2<double>> upper{};
+    for (double angle : angles) {
+        double r { radius(gen) };
+        upper.push_back(Point2<double>(r * std::cos(angle), r * std::sin(angle)));
+    }
+
+    std::vector<Point2<double>> nodes{ Point2<double>(radius(gen), 0) };
+    nodes.insert(nodes.end(), upper.begin(), upper.end());
+    nodes.push_back(Point2<double>(-radius(gen), 0));
+    for (auto it { upper.rbegin() }; it != upper.rend(); ++it) {
+        nodes.push_back(Point2<double>(it->x, -it->y));
+    }
+    return Polygon<double>{ nodes };
+}
+
+static Polygon<double> randomPolygon(int size, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> radius(1.0, 2.0);
+    std::vector<Point2<double>> nodes{};
+    for (int i{}; i < size; ++i) {
+        double angle { 2 * std::acos(-1) * i / size }, r { radius(gen) };
+        nodes.push_back(Point2<double>(r * std::cos(angle), r * std::sin(angle)));
+    }
+    return Polygon<double>{ nodes };
+}
+
+static void crossCheck(Polygon<double>& poly) {
+    SymmetryFinder<double> linear{ SymmetryEngine::Linear };
+    SymmetryFinder<double> vectorized{ SymmetryEngine::Vectorized };
+    SymmetryFinder<double> reference{ SymmetryEngine::Reference };
+    auto expected { reference.findSymmetry(poly, epsilon) };
+    auto result { linear.findSymmetry(poly, epsilon) };
+    EXPECT_TRUE(compareAxes(expected, result, epsilon));
+    result = vectorized.findSymmetry(poly, epsilon);
+    EXPECT_TRUE(compareAxes(expected, result, epsilon));
+}
+
+TEST(LinearEngineTest, RegularPolygons) {
+    for (int size{ 3 }; size <= 12; ++size) {
+        auto poly { regularPolygon(size, 3.0) };
+        SymmetryFinder<double> finder{};
+        EXPECT_EQ(finder.findSymmetry(poly, epsilon).size(), size);
+        crossCheck(poly);
+    }
+}
+
+TEST(LinearEngineTest, MirroredPolygons) {
+    for (unsigned seed{}; seed < 10; ++seed) {
+        auto poly { mirroredPolygon(3 + seed, seed) };
+        SymmetryFinder<double> finder{};
+        EXPECT_EQ(finder.findSymmetry(poly, epsilon).size(), 1);
+        crossCheck(poly);
+    }
+}
+
+TEST(LinearEngineTest, RandomPolygons) {
+    for (unsigned seed{}; seed < 10; ++seed) {
+        auto poly { randomPolygon(5 + seed, seed) };
+        SymmetryFinder<double> finder{};
+        EXPECT_TRUE(finder.findSymmetry(poly, epsilon).empty());
+        crossCheck(poly);
+    }
+}
+
+TEST(LinearEngineTest, ClockwiseOrder) {
+    std::vector<Axis<double>> axes
+    {
+       { Point2<double>(0,0), Point2<double>(0,3) },
+    };
+    Polygon<double> poly
+    {
+       std::vector<Point2<double>>
+       {
+          {0,0},
+          {-2,1},
+          {0,3},
+          {2,1},
+       }
+    };
+    SymmetryFinder<double> finder{};
+    auto result { finder.findSymmetry(poly, epsilon) };
+    EXPECT_TRUE(compareAxes(axes, result, epsilon));
+}
+
+// staircase that is symmetric relative to x = 0 when drift is 0: steps of right half are
+// wider by drift and steps of left half are narrower, so every token differs less than
+// 1e-8 from its mirror, but mirrored nodes move apart by 2 * drift on every step
+static Polygon<double> staircase(size_t steps, double drift) {
+    double h { 0.5 / steps };
+    std::vector<Point2<double>> nodes{ Point2<double>(steps * (h + drift), 0) };
+    for (size_t i{}; i < steps; ++i) {
+        auto last { nodes.back() };
+        nodes.push_back(Point2<double>(last.x, last.y + h));
+        nodes.push_back(Point2<double>(last.x - h - drift, last.y + h));
+    }
+    nodes.pop_back();
+    nodes.push_back(Point2<double>(0, 0.5));
+    for (size_t i{}; i < steps; ++i) {
+        auto last { nodes.back() };
+        nodes.push_back(Point2<double>(last.x - h + drift, last.y));
+        nodes.push_back(Point2<double>(last.x - h + drift, last.y - h));
+    }
+    return Polygon<double>{ nodes };
+}
+
+TEST(LinearEngineTest, TokenErrorsDoNotAddUp) {
+    for (size_t steps : { 16, 160, 400 }) {
+        SymmetryFinder<double> linear{ SymmetryEngine::Linear };
+        SymmetryFinder<double> reference{ SymmetryEngine::Reference };
+        auto poly { staircase(steps, 0.45e-8) };
+        EXPECT_EQ(reference.findSymmetry(poly, 1e-8).size(), 0);
+        EXPECT_EQ(linear.findSymmetry(poly, 1e-8).size(), 0);
+        EXPECT_EQ(linear.findSymmetryGroup(poly, 1e-8).axes.size(), 0);
+
+        poly = staircase(steps, 0);
+        auto expected { reference.findSymmetry(poly, 1e-8) };
+        auto result { linear.findSymmetry(poly, 1e-8) };
+        EXPECT_EQ(result.size(), 1);
+        EXPECT_TRUE(compareAxes(expected, result, 1e-8));
+    }
+}
+
+TEST(LinearEngineTest, AxesAreCheckedAloneWhenGroupBoundFails) {
+    // staircase and its mirror below x axis: horizontal axis is exact, vertical axis and
+    // rotation by pi drift, so bound of whole group fails and only horizontal axis is left
+    auto upper { staircase(40, 0.45e-8).getNodes() };
+    std::vector<Point2<double>> nodes { upper };
+    for (size_t i { upper.size() - 2 }; i > 0; --i) {
+        nodes.push_back(Point2<double>(upper[i].x, -upper[i].y));
+    }
+    Polygon<double> poly { nodes };
+    SymmetryFinder<double> linear{ SymmetryEngine::Linear };
+    SymmetryFinder<double> reference{ SymmetryEngine::Reference };
+    auto expected { reference.findSymmetry(poly, 1e-8) };
+    auto result { linear.findSymmetry(poly, 1e-8) };
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_TRUE(compareAxes(expected, result, 1e-8));
+    EXPECT_NEAR(result[0].getStart().y, 0, 1e-12);
+    EXPECT_NEAR(result[0].getEnd().y, 0, 1e-12);
+    EXPECT_EQ(linear.findSymmetryGroup(poly, 1e-8).rotationOrder, 1);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include "ReflectKernel.hpp"
+#include "SymmetryFinder.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+// shapes of BigNum and SmallNum suites in unit scale
+static std::vector<std::vector<Point2<double>>> shapes() {
+    return {
+        { {0, 0}, {1, 0}, {1, 1}, {0, 1} },
+        { {0, 0}, {2, 1}, {0, 3}, {-2, 1} },
+        { {0.1, 1}, {-1, 0}, {0, -1}, {1, -0.5}, {2, 1} },
+        { {0, 0}, {1, 0}, {0.5, std::sqrt(3) / 2} },
+        { {0, 0}, {2, 0}, {2, 1}, {0, 1} },
+        { {0, 0}, {2, 0}, {2.5, 1}, {0.5, 1} },
+        { {-5, 0}, {-2, -1}, {2, -1}, {5, 0}, {2, 1}, {-2, 1} },
+    };
+}
+
+static std::vector<std::pair<uint32_t, uint32_t>> normalize(const std::vector<CompactAxis>& axes) {
+    std::vector<std::pair<uint32_t, uint32_t>> result{};
+    for (const auto& axis : axes) {
+        result.push_back(std::minmax(axis.first, axis.second));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+static Polygon<double> scaled(const std::vector<Point2<double>>& nodes, double multiplier) {
+    std::vector<Point2<double>> result{};
+    for (const auto& node : nodes) {
+        result.push_back(multiplier * node);
+    }
+    return Polygon<double>{ result };
+}
+
+TEST(MixedPrecisionTest, FloatKernelChecksEveryLane) {
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<float> coord(-1.0f, 1.0f);
+    float angle { 0.3f }, dx { std::cos(angle) }, dy { std::sin(angle) };
+
+    for (size_t size{ 1 }; size < 40; ++size) {
+        std::vector<float> x(size), y(size), tx(size), ty(size);
+        for (size_t i{}; i < size; ++i) {
+            x[i] = coord(gen);
+            y[i] = coord(gen);
+            float twoDot { 2 * (x[i] * dx + y[i] * dy) };
+            tx[i] = twoDot * dx - x[i];
+            ty[i] = twoDot * dy - y[i];
+        }
+        EXPECT_TRUE(reflectAndCompare(x.data(), y.data(), tx.data(), ty.data(), size, dx, dy, 1e-5));
+
+        for (size_t broken{}; broken < size; ++broken) {
+            auto shifted { tx };
+            shifted[broken] += 1e-3f;
+            EXPECT_FALSE(reflectAndCompare(x.data(), y.data(), shifted.data(), ty.data(), size, dx, dy, 1e-5));
+        }
+    }
+}
+
+TEST(MixedPrecisionTest, SameAsDoubleOnBigAndSmallScales) {
+    SymmetryFinder<double> vectorized { SymmetryEngine::Vectorized }, mixed { SymmetryEngine::MixedPrecision };
+    // scales and epsilons of BigNum, SmallNum and unit tests
+    std::pair<double, double> scales[] { { 1e12, 1e-2 }, { 1e-8, 1e-20 }, { 1, 1e-8 }, { 1e-12, 1e-8 } };
+    for (const auto& [multiplier, epsilon] : scales) {
+        for (const auto& shape : shapes()) {
+            auto poly { scaled(shape, multiplier) };
+            EXPECT_EQ(normalize(mixed.findSymmetryCompact(poly, epsilon)), normalize(vectorized.findSymmetryCompact(poly, epsilon)))
+                << multiplier << " " << shape.size();
+        }
+    }
+}
+
+TEST(MixedPrecisionTest, DoubleVerificationRejectsFloatNoise) {
+    SymmetryFinder<double> vectorized { SymmetryEngine::Vectorized }, mixed { SymmetryEngine::MixedPrecision };
+    std::vector<Point2<double>> nodes{};
+    for (size_t i{}; i < 300; ++i) {
+        double angle { 2 * std::acos(-1) * i / 300 };
+        nodes.push_back(Point2<double>(std::cos(angle), std::sin(angle)));
+    }
+    EXPECT_EQ(mixed.findSymmetryCompact(scaled(nodes, 1), 1e-10).size(), 300);
+
+    // deviation below float presision is seen only by double, it breaks all axes but axis of symmetric pair
+    nodes[17].x *= 1 + 1e-8;
+    nodes[283].x *= 1 + 1e-8;
+    for (double multiplier : { 1e12, 1.0, 1e-6 }) {
+        auto poly { scaled(nodes, multiplier) };
+        auto expected { normalize(vectorized.findSymmetryCompact(poly, 1e-10)) };
+        EXPECT_EQ(normalize(mixed.findSymmetryCompact(poly, 1e-10)), expected) << multiplier;
+        if (multiplier == 1) {
+            EXPECT_EQ(expected.size(), 1);
+        }
+    }
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "PolygonFile.hpp"
+#include "SpscQueue.hpp"
+#include "SymmetryFinder.hpp"
+#include "SymmetryPipeline.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::vector<Polygon<double>> samplePolygons(size_t count) {
+    std::vector<Polygon<double>> polygons{};
+    for (size_t i{}; i < count; ++i) {
+        std::vector<Point2<double>> nodes{};
+        size_t size { 3 + i % 9 };
+        for (size_t k{}; k < size; ++k) {
+            double angle { 2 * std::acos(-1) * k / size };
+            // every third polygon is not symmetric
+            double radius { i % 3 == 2 && k == 1 ? 1.5 : 1.0 };
+            nodes.push_back(Point2<double>(100 + i + radius * std::cos(angle), -50 + radius * std::sin(angle)));
+        }
+        polygons.push_back(Polygon<double>{ nodes });
+    }
+    return polygons;
+}
+
+/// <summary>
+/// Parse output of pipeline: label and numbers of axes for every polygon
+/// </summary>
+static std::vector<std::pair<std::string, std::vector<double>>> parseOutput(const std::string& text) {
+    std::vector<std::pair<std::string, std::vector<double>>> result{};
+    std::istringstream in { text };
+    std::string line{};
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == ':') {
+            result.push_back({ line.substr(0, line.size() - 1), {} });
+        } else if (line != "non-symmetric") {
+            double x1{}, y1{}, x2{}, y2{};
+            EXPECT_EQ(std::sscanf(line.c_str(), "(%lf, %lf) - (%lf, %lf)", &x1, &y1, &x2, &y2), 4) << line;
+            result.back().second.insert(result.back().second.end(), { x1, y1, x2, y2 });
+        }
+    }
+    return result;
+}
+
+TEST(SpscQueueTest, OrderAndBackpressure) {
+    SpscQueue<size_t> queue { 3 };
+    EXPECT_EQ(queue.capacity(), 4u);
+    std::thread producer([&] {
+        for (size_t i{}; i < 100000; ++i) {
+            queue.push(i);
+        }
+        queue.close();
+    });
+    size_t value{}, expected{};
+    while (queue.pop(value)) {
+        ASSERT_EQ(value, expected++);
+    }
+    producer.join();
+    EXPECT_EQ(expected, 100000u);
+
+    size_t item { 7 };
+    EXPECT_FALSE(queue.push(item));
+}
+
+TEST(PipelineTest, SameAxesInInputOrder) {
+    auto polygons { samplePolygons(500) };
+    auto textPath { std::filesystem::temp_directory_path() / "find_symmetry_pipeline_test.txt" };
+    auto binaryPath { std::filesystem::temp_directory_path() / "find_symmetry_pipeline_test.bin" };
+    {
+        std::ofstream out { textPath };
+        out.precision(17);
+        for (const auto& polygon : polygons) {
+            out << "# polygon\n";
+            for (const auto& node : polygon.getNodes()) {
+                out << node.x << " " << node.y << "\n";
+            }
+        }
+    }
+    writePolygonFile(binaryPath.string(), polygons);
+
+    // small chunks and queues, so stages block each other
+    SymmetryPipeline pipeline { 3, 4, 256 };
+    std::ostringstream out{};
+    auto count { pipeline.run({ textPath.string(), binaryPath.string() }, out) };
+    EXPECT_EQ(count, 2 * polygons.size());
+
+    auto result { parseOutput(out.str()) };
+    ASSERT_EQ(result.size(), 2 * polygons.size());
+    SymmetryFinder<double> finder{};
+    for (size_t i{}; i < result.size(); ++i) {
+        const auto& polygon { polygons[i % polygons.size()] };
+        auto filename { i < polygons.size() ? textPath.string() : binaryPath.string() };
+        EXPECT_EQ(result[i].first, filename + "[" + std::to_string(i % polygons.size()) + "]");
+
+        std::vector<double> expected{};
+        for (const auto& axis : finder.findSymmetry(polygon, 1e-8)) {
+            for (const auto& point : { axis.getStart(), axis.getEnd() }) {
+                expected.push_back(point.x);
+                expected.push_back(point.y);
+            }
+        }
+        ASSERT_EQ(result[i].second.size(), expected.size()) << result[i].first;
+        for (size_t k{}; k < expected.size(); ++k) {
+            EXPECT_NEAR(result[i].second[k], expected[k], 1e-5);
+        }
+    }
+    std::filesystem::remove(textPath);
+    std::filesystem::remove(binaryPath);
+}
+
+TEST(PipelineTest, ErrorOfStageIsRethrown) {
+    auto path { std::filesystem::temp_directory_path() / "find_symmetry_pipeline_bad.txt" };
+    {
+        std::ofstream out { path };
+        out << "0 0\n1 0\n1 x\n";
+    }
+    SymmetryPipeline pipeline { 2 };
+    std::ostringstream out{};
+    EXPECT_THROW(pipeline.run({ path.string() }, out), std::runtime_error);
+    EXPECT_THROW(pipeline.run({ "no_such_file.txt" }, out), std::runtime_error);
+    std::filesystem::remove(path);
+}
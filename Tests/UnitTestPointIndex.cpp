@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include "Point2.hpp"
+#include "Polygon.hpp"
+#include "PointIndex.hpp"
+
+#include <cmath>
+#include <vector>
+#include <random>
+
+static size_t findLinear(const std::vector<Point2<double>>& nodes, const Point2<double>& p, double epsilon) {
+    for (size_t i{}; i < nodes.size(); ++i) {
+        if (p.isEqual(nodes[i], epsilon)) {
+            return i;
+        }
+    }
+    return PointIndex<double>::npos;
+}
+
+TEST(PointIndexTest, SameAsLinearScan) {
+    std::mt19937 gen(3);
+    for (double scale : { 1e-8, 1.0, 1e12 }) {
+        double epsilon { scale > 1 ? 1e-2 : 1e-6 };
+        std::uniform_real_distribution<double> coord(-scale, scale), shift(-2 * epsilon, 2 * epsilon);
+        std::vector<Point2<double>> nodes{};
+        for (int i{}; i < 500; ++i) {
+            nodes.push_back(Point2<double>(coord(gen), coord(gen)));
+        }
+        PointIndex<double> index{ nodes, epsilon };
+
+        for (const auto& node : nodes) {
+            // points around node on both sides of tolerance
+            double tolerance { std::max(1.0, std::fabs(node.x)) };
+            Point2<double> p(node.x + shift(gen) * tolerance, node.y + shift(gen) * std::max(1.0, std::fabs(node.y)));
+            EXPECT_EQ(index.find(p), findLinear(nodes, p, epsilon));
+        }
+    }
+}
+
+TEST(PointIndexTest, CellBoundary) {
+    constexpr double epsilon{ 1e-3 };
+    std::vector<Point2<double>> nodes{};
+    for (int i{}; i < 100; ++i) {
+        nodes.push_back(Point2<double>(100.0 * i, 0));
+    }
+    PointIndex<double> index{ nodes, epsilon };
+
+    // relative tolerance is 0.1 * 1000 for node 10
+    EXPECT_EQ(index.find(Point2<double>(1000.0 + 0.99 * epsilon * 1000.0, 0)), 10);
+    EXPECT_EQ(index.find(Point2<double>(1000.0 - 0.99 * epsilon * 1000.0, 0)), 10);
+    EXPECT_EQ(index.find(Point2<double>(1000.0 + 1.1 * epsilon * 1000.0, 0)), PointIndex<double>::npos);
+    EXPECT_EQ(index.find(Point2<double>(-1e6, 0)), PointIndex<double>::npos);
+}
+
+TEST(PointIndexTest, FewNodesScannedOnRegularPolygon) {
+    // nodes lie along circle, so cells of size extent / sqrt(N) would hold about sqrt(N) nodes
+    constexpr size_t size{ 100000 };
+    std::vector<Point2<double>> nodes(size);
+    for (size_t i{}; i < size; ++i) {
+        double angle { 2 * std::acos(-1) * i / size };
+        nodes[i] = Point2<double>(3 * std::cos(angle), 3 * std::sin(angle));
+    }
+    PointIndex<double> index{ nodes, 1e-8 };
+
+    size_t scanned{}, queries{};
+    for (size_t i{}; i < size; i += 97) {
+        EXPECT_EQ(index.find(nodes[i]), i);
+        scanned += index.getScanCount(nodes[i]);
+        ++queries;
+    }
+    EXPECT_LE(scanned, 8 * queries);
+}
+
+TEST(PointIndexTest, PolygonIsEqualWithIndex) {
+    std::vector<Point2<double>> nodes { {0,0}, {2,1}, {0,3}, {-2,1} };
+    std::vector<Point2<double>> shifted { {0,3}, {2,1}, {0,0}, {-2,1} };
+    Polygon<double> a{ nodes }, b{ shifted };
+    PointIndex<double> index{ shifted, 1e-6 };
+    EXPECT_TRUE(a.isEqual(b, 1e-6, index));
+    EXPECT_EQ(a.isEqual(b, 1e-6), a.isEqual(b, 1e-6, index));
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "Point2.hpp"
+#include "PointSet.hpp"
+#include "PointSetSymmetry.hpp"
+#include "TestHelpers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+constexpr double pi { 3.14159265358979323846 };
+
+static std::vector<Point2<double>> ring(size_t count, double radius, double phase) {
+    std::vector<Point2<double>> points{};
+    for (size_t i{}; i < count; ++i) {
+        double angle { phase + 2 * pi * i / count };
+        points.push_back(Point2<double>(radius * std::cos(angle), radius * std::sin(angle)));
+    }
+    return points;
+}
+
+TEST(PointSetTest, OrderDoesNotMatter) {
+    std::vector<Point2<double>> points { {0, 0}, {2, 2}, {2, 0}, {0, 2} };
+    PointSetSymmetry<double> finder{};
+    std::mt19937 gen(3);
+    for (int i{}; i < 5; ++i) {
+        std::shuffle(points.begin(), points.end(), gen);
+        auto axes { finder.findSymmetry(PointSet<double>{ points }, 1e-9) };
+        ASSERT_EQ(axes.size(), 4);
+        for (const auto& axis : axes) {
+            auto center { (axis.getStart() + axis.getEnd()) / 2.0 };
+            EXPECT_TRUE(center.isEqual(Point2<double>(1, 1), 1e-12));
+        }
+    }
+}
+
+TEST(PointSetTest, ShellsAreIntersected) {
+    // hexagon and pentagon share only axis along x, center point lies on every axis
+    auto points { ring(6, 1, 0) };
+    auto pentagon { ring(5, 2, 0) };
+    points.insert(points.end(), pentagon.begin(), pentagon.end());
+    points.push_back(Point2<double>(0, 0));
+    auto axes { PointSetSymmetry<double>{}.findSymmetry(PointSet<double>{ points }, 1e-9) };
+    ASSERT_EQ(axes.size(), 1);
+    EXPECT_NEAR(getAngle(axes[0]), 0, 1e-9);
+
+    // rings alone keep all their axes
+    EXPECT_EQ(PointSetSymmetry<double>{}.findSymmetry(PointSet<double>{ ring(6, 1, 0.3) }, 1e-9).size(), 6);
+    EXPECT_EQ(PointSetSymmetry<double>{}.findSymmetry(PointSet<double>{ ring(5, 2, 0) }, 1e-9).size(), 5);
+}
+
+TEST(PointSetTest, MirroredCloud) {
+    std::mt19937 gen(5);
+    std::uniform_real_distribution<double> coord(-10, 10);
+    double axisAngle { 0.4 };
+    Point2<double> direction { std::cos(axisAngle), std::sin(axisAngle) }, shift { 3, -2 };
+    std::vector<Point2<double>> points{};
+    for (int i{}; i < 500; ++i) {
+        Point2<double> p { coord(gen), coord(gen) };
+        double twoDot { 2 * (p.x * direction.x + p.y * direction.y) };
+        points.push_back(p + shift);
+        points.push_back(Point2<double>(twoDot * direction.x - p.x, twoDot * direction.y - p.y) + shift);
+    }
+    std::shuffle(points.begin(), points.end(), gen);
+    PointSetSymmetry<double> finder{};
+    auto axes { finder.findSymmetry(PointSet<double>{ points }, 1e-9) };
+    ASSERT_EQ(axes.size(), 1);
+    EXPECT_NEAR(getAngle(axes[0]), axisAngle, 1e-9);
+    // axis goes through shift
+    auto offset { (axes[0].getStart() + axes[0].getEnd()) / 2.0 - shift };
+    EXPECT_NEAR(offset.cross(direction), 0, 1e-9);
+
+    // one moved point breaks symmetry
+    points[123].x += 1e-3;
+    EXPECT_TRUE(finder.findSymmetry(PointSet<double>{ points }, 1e-9).empty());
+}
+
+TEST(PointSetTest, DegenerateSets) {
+    PointSetSymmetry<double> finder{};
+    EXPECT_TRUE(finder.findSymmetry(PointSet<double>{}, 1e-9).empty());
+    EXPECT_TRUE(finder.findSymmetry(PointSet<double>{ std::vector<Point2<double>>{ {1, 1} } }, 1e-9).empty());
+    // copies of one point are in centroid, every line is axis and none is listed
+    EXPECT_TRUE(finder.findSymmetry(PointSet<double>{ std::vector<Point2<double>>{ {1, 1}, {1, 1}, {1, 1} } }, 1e-9).empty());
+    EXPECT_TRUE(PointSetSymmetry<int64_t>{}.findSymmetry(PointSet<int64_t>{ std::vector<Point2<int64_t>>{ {-3, 2}, {-3, 2} } }, 0).empty());
+
+    // collinear points: the line and perpendicular through centroid
+    auto axes { finder.findSymmetry(PointSet<double>{ std::vector<Point2<double>>{ {0, 0}, {1, 1}, {3, 3}, {4, 4} } }, 1e-9) };
+    ASSERT_EQ(axes.size(), 2);
+    std::vector<double> angles { getAngle(axes[0]), getAngle(axes[1]) };
+    std::sort(angles.begin(), angles.end());
+    EXPECT_NEAR(angles[0], pi / 4, 1e-9);
+    EXPECT_NEAR(angles[1], 3 * pi / 4, 1e-9);
+
+    // duplicated points do not duplicate axes
+    auto square { ring(4, 1, 0) };
+    square.insert(square.end(), square.begin(), square.end());
+    EXPECT_EQ(finder.findSymmetry(PointSet<double>{ square }, 1e-9).size(), 4);
+}
+
+TEST(PointSetTest, BigAndSmallScales) {
+    for (double multiplier : { 1e12, 1e-8 }) {
+        std::vector<Point2<double>> points{};
+        for (const auto& p : ring(8, 1, 0.1)) {
+            points.push_back(multiplier * p);
+        }
+        double epsilon { multiplier > 1 ? 1e-9 : 1e-20 };
+        EXPECT_EQ(PointSetSymmetry<double>{}.findSymmetry(PointSet<double>{ points }, epsilon).size(), 8) << multiplier;
+    }
+}
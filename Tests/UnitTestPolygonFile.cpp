@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "PolygonFile.hpp"
+#include "PolygonView.hpp"
+#include "SymmetryFinder.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+static std::vector<Polygon<double>> samplePolygons() {
+    return {
+        Polygon<double>{ std::vector<Point2<double>>{ {0,0}, {2,0}, {2,2}, {0,2} } },
+        Polygon<double>{ std::vector<Point2<double>>{ {0,0}, {4,0}, {1,3} } },
+        Polygon<double>{ std::vector<Point2<double>>{ {0,0}, {-2,1}, {0,3}, {2,1} } },
+    };
+}
+
+TEST(PolygonFileTest, WriteAndMap) {
+    auto path { std::filesystem::temp_directory_path() / "find_symmetry_polygon_file_test.bin" };
+    auto polygons { samplePolygons() };
+    writePolygonFile(path.string(), polygons);
+
+    {
+        PolygonFile file { path.string() };
+        ASSERT_EQ(file.size(), polygons.size());
+        // random access, polygon 2 before polygon 0
+        for (size_t i : { 2, 0, 1 }) {
+            auto view { file[i] };
+            ASSERT_EQ(view.size(), polygons[i].getNodes().size());
+            for (size_t k{}; k < view.size(); ++k) {
+                EXPECT_EQ(view[k].x, polygons[i].getNodes()[k].x);
+                EXPECT_EQ(view[k].y, polygons[i].getNodes()[k].y);
+            }
+        }
+
+        SymmetryFinder<double> finder{};
+        auto views { file.getViews() };
+        auto results { finder.findSymmetryBatch(std::span<const PolygonView<double>>(views), 1e-8) };
+        ASSERT_EQ(results.size(), 3);
+        EXPECT_EQ(results[0].size(), 4);
+        EXPECT_TRUE(results[1].empty());
+        EXPECT_EQ(results[2].size(), 1);
+    }
+    EXPECT_TRUE(PolygonFile::isPolygonFile(path.string()));
+    std::filesystem::remove(path);
+}
+
+TEST(PolygonFileTest, ConvertTextFile) {
+    auto input { std::filesystem::temp_directory_path() / "find_symmetry_convert_test.txt" };
+    auto output { std::filesystem::temp_directory_path() / "find_symmetry_convert_test.bin" };
+    {
+        std::ofstream out(input);
+        out << "0 0\n1 0\n1 1\n0 1\n\n0 0\n2 0\n1 5\n";
+    }
+    EXPECT_EQ(convertPolygonFile(input.string(), output.string()), 2);
+    EXPECT_FALSE(PolygonFile::isPolygonFile(input.string()));
+    {
+        PolygonFile file { output.string() };
+        ASSERT_EQ(file.size(), 2);
+        EXPECT_EQ(file[1].size(), 3);
+        EXPECT_EQ(file[1][2].y, 5);
+    }
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+}
+
+TEST(PolygonFileTest, InvalidFile) {
+    auto path { std::filesystem::temp_directory_path() / "find_symmetry_invalid_file_test.bin" };
+    writePolygonFile(path.string(), samplePolygons());
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+    EXPECT_THROW(PolygonFile{ path.string() }, std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(PolygonViewTest, ViewOfPolygonAndSoA) {
+    auto polygons { samplePolygons() };
+    SymmetryFinder<double> linear{}, reference{ SymmetryEngine::Reference };
+    for (const auto& polygon : polygons) {
+        PolygonView<double> view { polygon };
+        EXPECT_EQ(linear.findSymmetry(view, 1e-8).size(), linear.findSymmetry(polygon, 1e-8).size());
+        EXPECT_EQ(reference.findSymmetry(view, 1e-8).size(), linear.findSymmetry(polygon, 1e-8).size());
+
+        PolygonSoA<double> soa { polygon.getNodes() };
+        EXPECT_EQ(linear.findSymmetry(soa.getView(), 1e-8).size(), linear.findSymmetry(polygon, 1e-8).size());
+    }
+}
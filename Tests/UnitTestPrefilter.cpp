@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include "SymmetryFinder.hpp"
+#include "InvariantSignature.hpp"
+#include "CandidateProbe.hpp"
+
+#include <vector>
+
+constexpr double epsilon{ 1e-6 };
+
+TEST(PrefilterTest, RejectsNonSymmetric) {
+    Polygon<double> poly
+    {
+        std::vector<Point2<double>>
+        {
+         {0.1,1.0},
+         {-1.0,0.0},
+         {0.0,-1.0},
+         {1.0,-0.5},
+         {2.0, 1.0},
+        }
+    };
+    SymmetryFinder<double> finder{ SymmetryEngine::Vectorized };
+    EXPECT_TRUE(finder.findSymmetry(poly, epsilon).empty());
+    EXPECT_EQ(finder.getPrefilterStats().checked, 1);
+    EXPECT_EQ(finder.getPrefilterStats().rejected, 1);
+
+    finder.resetPrefilterStats();
+    EXPECT_EQ(finder.getPrefilterStats().checked, 0);
+
+    // Reference engine is independent check, it evaluates every candidate
+    SymmetryFinder<double> reference{ SymmetryEngine::Reference };
+    EXPECT_TRUE(reference.findSymmetry(poly, epsilon).empty());
+    EXPECT_EQ(reference.getPrefilterStats().checked, 0);
+}
+
+TEST(PrefilterTest, PassesSymmetric) {
+    std::vector<Point2<double>> nodes
+    {
+       {-5,0},
+       {-2,-1},
+       {2,-1},
+       {5,0},
+       {2,1},
+       {-2,1},
+    };
+    InvariantSignature<double> signature{};
+    EXPECT_TRUE(signature.maybeSymmetric(nodes, epsilon));
+
+    SymmetryFinder<double> finder{ SymmetryEngine::Vectorized };
+    EXPECT_EQ(finder.findSymmetry(Polygon<double>{ nodes }, epsilon).size(), 2);
+    EXPECT_EQ(finder.getPrefilterStats().rejected, 0);
+}
+
+TEST(PrefilterTest, ParallelogramIsNotRejected) {
+    // parallelogram has paired radii, edges and turns but no axes
+    std::vector<Point2<double>> nodes
+    {
+       {-1.25,-0.5},
+       {0.75,-0.5},
+       {1.25,0.5},
+       {-0.75,0.5},
+    };
+    InvariantSignature<double> signature{};
+    EXPECT_TRUE(signature.maybeSymmetric(nodes, epsilon));
+}
+
+TEST(ProbeTest, RejectsWrongAxis) {
+    std::vector<Point2<double>> nodes
+    {
+       {-5,0},
+       {-2,-1},
+       {2,-1},
+       {5,0},
+       {2,1},
+       {-2,1},
+    };
+    PointIndex<double> index{ nodes, epsilon };
+    CandidateProbe<double> probe{ nodes, index, 4 };
+    EXPECT_TRUE(probe.mayBeAxis(Point2<double>(1, 0)));
+    EXPECT_TRUE(probe.mayBeAxis(Point2<double>(0, 1)));
+    EXPECT_FALSE(probe.mayBeAxis(Point2<double>(1, 1).getNormalized()));
+}
+
+TEST(ProbeTest, SameAxesWithoutProbe) {
+    std::vector<Point2<double>> nodes{};
+    for (int i{}; i < 24; ++i) {
+        double angle { 2 * std::acos(-1) * i / 24 }, r { i % 2 == 0 ? 1.0 : 1.5 };
+        nodes.push_back(Point2<double>(r * std::cos(angle), r * std::sin(angle)));
+    }
+    for (auto engine : { SymmetryEngine::Vectorized, SymmetryEngine::MixedPrecision }) {
+        SymmetryFinder<double> withProbe{ engine };
+        SymmetryFinder<double> withoutProbe{ engine };
+        withoutProbe.setProbeCount(0);
+        EXPECT_EQ(withProbe.findSymmetry(Polygon<double>{ nodes }, epsilon).size(), 12);
+        EXPECT_EQ(withoutProbe.findSymmetry(Polygon<double>{ nodes }, epsilon).size(), 12);
+    }
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "PolygonReader.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+static std::vector<Polygon<double>> parse(const std::string& text) {
+    return parsePolygons<double>(text.data(), text.data() + text.size());
+}
+
+TEST(ReaderTest, TrailingNewlineGivesNoExtraNode) {
+    auto polygons { parse("0 0\n1 0\n1 1\n0 1\n") };
+    ASSERT_EQ(polygons.size(), 1);
+    ASSERT_EQ(polygons[0].getNodes().size(), 4);
+    EXPECT_EQ(polygons[0].getNodes()[2].x, 1);
+    EXPECT_EQ(polygons[0].getNodes()[2].y, 1);
+}
+
+TEST(ReaderTest, SeveralPolygons) {
+    auto polygons { parse("# square\r\n0 0\r\n1 0\r\n1 1\r\n0 1\r\n# triangle\n0 0\n+1.5 -2e-3\n\t0.5  1\n\n\n-1 -1\n1 -1\n1 1\n") };
+    ASSERT_EQ(polygons.size(), 3);
+    EXPECT_EQ(polygons[0].getNodes().size(), 4);
+    EXPECT_EQ(polygons[1].getNodes().size(), 3);
+    EXPECT_EQ(polygons[1].getNodes()[1].x, 1.5);
+    EXPECT_EQ(polygons[1].getNodes()[1].y, -2e-3);
+    EXPECT_EQ(polygons[2].getNodes().size(), 3);
+}
+
+TEST(ReaderTest, InvalidInput) {
+    EXPECT_THROW(parse("0 0\n1\n"), std::runtime_error);
+    EXPECT_THROW(parse("0 0\n1 x\n"), std::runtime_error);
+    EXPECT_THROW(parse("0 0\n1 2abc\n"), std::runtime_error);
+    EXPECT_TRUE(parse("").empty());
+}
+
+TEST(ReaderTest, ReadMappedFile) {
+    auto path { std::filesystem::temp_directory_path() / "find_symmetry_reader_test.txt" };
+    {
+        std::ofstream out(path);
+        out << "0 0\n2 1\n0 3\n-2 1\n\n0 0\n1 0\n0 1";
+    }
+    auto polygons { readPolygons<double>(path.string()) };
+    ASSERT_EQ(polygons.size(), 2);
+    EXPECT_EQ(polygons[0].getNodes().size(), 4);
+    EXPECT_EQ(polygons[1].getNodes().size(), 3);
+    EXPECT_EQ(readPolygon<double>(path.string()).getNodes().size(), 4);
+    std::filesystem::remove(path);
+
+    EXPECT_THROW(readPolygons<double>(path.string()), std::runtime_error);
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include "Point2.hpp"
+#include "PolygonSoA.hpp"
+#include "ReflectKernel.hpp"
+
+#include <vector>
+#include <random>
+
+constexpr double epsilon{ 1e-9 };
+
+TEST(ReflectKernelTest, SameAsScalar) {
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> coord(-10.0, 10.0);
+    double angle { 0.3 }, dx { std::cos(angle) }, dy { std::sin(angle) };
+
+    for (size_t size{ 1 }; size < 40; ++size) {
+        std::vector<double> x(size), y(size), tx(size), ty(size);
+        for (size_t i{}; i < size; ++i) {
+            x[i] = coord(gen);
+            y[i] = coord(gen);
+            double twoDot { 2 * (x[i] * dx + y[i] * dy) };
+            tx[i] = twoDot * dx - x[i];
+            ty[i] = twoDot * dy - y[i];
+        }
+        EXPECT_TRUE(reflectAndCompare(x.data(), y.data(), tx.data(), ty.data(), size, dx, dy, epsilon));
+
+        // every lane of every block must be checked
+        for (size_t broken{}; broken < size; ++broken) {
+            auto shifted { ty };
+            shifted[broken] += 1e-3;
+            EXPECT_FALSE(reflectAndCompare(x.data(), y.data(), tx.data(), shifted.data(), size, dx, dy, epsilon));
+            EXPECT_FALSE(reflectAndCompareScalar(x.data(), y.data(), tx.data(), shifted.data(), size, dx, dy, epsilon));
+        }
+    }
+}
+
+TEST(ReflectKernelTest, ReflectionTargets) {
+    std::vector<Point2<double>> nodes
+    {
+       {-5,0},
+       {-2,-1},
+       {2,-1},
+       {5,0},
+       {2,1},
+       {-2,1},
+    };
+    PointIndex<double> index{ nodes, epsilon };
+    ReflectionTargets<double> targets{ nodes, index };
+    EXPECT_TRUE(targets.isAxis(Point2<double>(1, 0), epsilon));
+    EXPECT_TRUE(targets.isAxis(Point2<double>(0, 1), epsilon));
+    EXPECT_FALSE(targets.isAxis(Point2<double>(1, 1).getNormalized(), epsilon));
+}
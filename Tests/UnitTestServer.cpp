@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "PolygonView.hpp"
+#include "SymmetryFinder.hpp"
+#include "SymmetryServer.hpp"
+#include "ThreadPool.hpp"
+#include "TestHelpers.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+/// <summary>
+/// Send polygons from other thread and receive all responses by id
+/// </summary>
+static std::map<uint64_t, SymmetryResponse> sendAll(SymmetryClient& client, const std::vector<Polygon<double>>& polygons) {
+    std::thread sender([&] {
+        for (size_t i{}; i < polygons.size(); ++i) {
+            client.send(i, PolygonView<double>(polygons[i]), 1e-8);
+        }
+        client.finish();
+    });
+    std::map<uint64_t, SymmetryResponse> responses{};
+    SymmetryResponse response{};
+    while (client.receive(response)) {
+        responses[response.id] = response;
+    }
+    sender.join();
+    return responses;
+}
+
+TEST(ServerTest, PipelinedStream) {
+    ThreadPool pool { 4 };
+    SymmetryServer server { 3, &pool };
+    EXPECT_EQ(server.getMaxInFlight(), 3u);
+
+    int requests[2]{}, responses[2]{};
+    ASSERT_EQ(::pipe(requests), 0);
+    ASSERT_EQ(::pipe(responses), 0);
+    size_t served{};
+    std::thread thread([&] {
+        served = server.serve(requests[0], responses[1]);
+        ::close(responses[1]);
+    });
+
+    std::vector<Polygon<double>> polygons{};
+    for (size_t i{}; i < 200; ++i) {
+        polygons.push_back(regularPolygon(3 + i % 50, 1 + i));
+    }
+    SymmetryClient client { requests[1], responses[0] };
+    auto result { sendAll(client, polygons) };
+    thread.join();
+    ::close(requests[0]);
+    ::close(responses[0]);
+
+    EXPECT_EQ(served, polygons.size());
+    ASSERT_EQ(result.size(), polygons.size());
+    SymmetryFinder<double> finder{};
+    for (size_t i{}; i < polygons.size(); ++i) {
+        ASSERT_TRUE(result[i].ok);
+        auto expected { finder.findSymmetry(polygons[i], 1e-8) };
+        ASSERT_EQ(result[i].axes.size(), expected.size());
+        for (size_t k{}; k < expected.size(); ++k) {
+            EXPECT_TRUE(result[i].axes[k].isEqual(expected[k], 1e-12));
+        }
+    }
+}
+
+TEST(ServerTest, UnixSocket) {
+    std::string path { "/tmp/findsymmetry-test-" + std::to_string(::getpid()) + ".sock" };
+    SymmetryServer server { 2 };
+    std::thread thread([&] { server.listen(path, 2); });
+
+    // server binds socket in other thread
+    std::unique_ptr<SymmetryClient> client{};
+    for (int attempt{}; attempt < 500 && !client; ++attempt) {
+        try {
+            client = std::make_unique<SymmetryClient>(path);
+        } catch (const std::runtime_error&) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    ASSERT_TRUE(client);
+
+    std::vector<Polygon<double>> polygons { regularPolygon(6, 2), Polygon<double>{ { { 0, 0 }, { 3, 0 }, { 1, 2 } } } };
+    auto result { sendAll(*client, polygons) };
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_EQ(result[0].axes.size(), 6u);
+    EXPECT_TRUE(result[1].ok);
+    EXPECT_TRUE(result[1].axes.empty());
+    client.reset();
+
+    // second client is served by the same process and pool
+    SymmetryClient second { path };
+    auto other { sendAll(second, { regularPolygon(4, 1) }) };
+    ASSERT_EQ(other.size(), 1u);
+    EXPECT_EQ(other[0].axes.size(), 4u);
+    thread.join();
+}
+
+TEST(ServerTest, MalformedRequest) {
+    SymmetryServer server { 1 };
+    int fds[2]{};
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    uint32_t length { 5 };
+    char payload[5]{};
+    ::write(fds[1], &length, sizeof(length));
+    ::write(fds[1], payload, sizeof(payload));
+    ::shutdown(fds[1], SHUT_WR);
+    EXPECT_THROW(server.serve(fds[0], fds[0]), std::runtime_error);
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
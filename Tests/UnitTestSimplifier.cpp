@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "PolygonView.hpp"
+#include "Point2.hpp"
+#include "PolygonSimplifier.hpp"
+#include "SymmetryFinder.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// square with side 2, every side is split into count edges of different length and every node is repeated,
+// power 1 splits sides evenly
+static Polygon<double> splitSquare(size_t count, double power = 1.5) {
+    Point2<double> corners[] { {0, 0}, {2, 0}, {2, 2}, {0, 2} };
+    std::vector<Point2<double>> nodes{};
+    for (size_t side{}; side < 4; ++side) {
+        auto a { corners[side] }, b { corners[(side + 1) % 4] };
+        for (size_t i{}; i < count; ++i) {
+            double t { std::pow(double(i) / count, power) };
+            nodes.push_back(a + (b - a) * t);
+            nodes.push_back(a + (b - a) * t);
+        }
+    }
+    return Polygon<double>{ nodes };
+}
+
+TEST(SimplifierTest, MergesDuplicatesAndCollinearNodes) {
+    auto square { splitSquare(5) };
+    PolygonSimplifier<double> simplifier{};
+    simplifier.simplify(PolygonView<double>(square), 1e-8);
+    ASSERT_EQ(simplifier.getNodes().size(), 4);
+    std::vector<size_t> expected { 0, 10, 20, 30 };
+    EXPECT_EQ(simplifier.getIndices(), expected);
+    for (size_t i{}; i < 4; ++i) {
+        EXPECT_TRUE(simplifier.getNodes()[i].isEqual(square.getNodes()[expected[i]], 0));
+    }
+}
+
+TEST(SimplifierTest, RingIsClosedAcrossFirstNode) {
+    // first nodes lie inside bottom side, last node repeats first
+    Polygon<double> p { std::vector<Point2<double>>{ {1, 0}, {1.5, 0}, {2, 0}, {2, 2}, {0, 2}, {0, 0}, {0.5, 0}, {1, 0} } };
+    PolygonSimplifier<double> simplifier{};
+    simplifier.simplify(p.getNodes(), 1e-8);
+    std::vector<size_t> expected { 2, 3, 4, 5 };
+    EXPECT_EQ(simplifier.getIndices(), expected);
+}
+
+TEST(SimplifierTest, SmallTurnsAndSpikesAreKept) {
+    std::vector<Point2<double>> nodes{};
+    for (size_t i{}; i < 100000; ++i) {
+        double angle { 2 * std::acos(-1) * i / 100000 };
+        nodes.push_back(Point2<double>(std::cos(angle), std::sin(angle)));
+    }
+    PolygonSimplifier<double> simplifier{};
+    simplifier.simplify(nodes, 1e-8);
+    EXPECT_EQ(simplifier.getNodes().size(), nodes.size());
+
+    // needle goes back along the same line, it is not collinear
+    Polygon<double> needle { std::vector<Point2<double>>{ {0, 0}, {2, 0}, {1, 0}, {1, 1} } };
+    simplifier.simplify(needle.getNodes(), 1e-8);
+    EXPECT_EQ(simplifier.getNodes().size(), 4);
+}
+
+TEST(SimplifierTest, IntegerCollinearIsExact) {
+    std::vector<Point2<int64_t>> nodes { {0, 0}, {3, 0}, {6, 0}, {6, 4}, {6, 4}, {0, 4}, {0, 1} };
+    PolygonSimplifier<int64_t> simplifier{};
+    simplifier.simplify(nodes, 0);
+    std::vector<size_t> expected { 0, 2, 3, 5 };
+    EXPECT_EQ(simplifier.getIndices(), expected);
+}
+
+TEST(SimplifierTest, FinderFindsHiddenSymmetryOfLargePolygon) {
+    // without simplification uneven split of sides hides axes
+    SymmetryFinder<double> finder{};
+    EXPECT_EQ(finder.getSimplifyThreshold(), SymmetryFinder<double>::kDefaultSimplifyThreshold);
+    finder.setSimplifyThreshold(SIZE_MAX);
+    EXPECT_TRUE(finder.findSymmetry(splitSquare(2000), 1e-8).empty());
+
+    // large polygon is simplified by default, duplicate nodes are merged and middles of even sides are original nodes
+    auto square { splitSquare(2000, 1) };
+    finder.setSimplifyThreshold(SymmetryFinder<double>::kDefaultSimplifyThreshold);
+    auto axes { finder.findSymmetry(square, 1e-8) };
+    ASSERT_EQ(axes.size(), 4);
+    Axis<double> vertical { Point2<double>(1, 0), Point2<double>(1, 2) };
+    EXPECT_TRUE(std::any_of(axes.begin(), axes.end(), [&](Axis<double>& axis) { return axis.isEqual(vertical, 1e-12); }));
+}
+
+TEST(SimplifierTest, AxesAreMappedToOriginalElements) {
+    // middles of uneven sides are not original nodes or middles of edges, only diagonals are kept
+    auto square { splitSquare(2000) };
+    SymmetryFinder<double> finder{};
+    finder.setSimplifyThreshold(4096);
+    SymmetryWorkspace<double> workspace{};
+    auto axes { finder.findSymmetry(PolygonView<double>(square), 1e-8, workspace) };
+    ASSERT_EQ(axes.size(), 2);
+    Axis<double> diagonal { Point2<double>(0, 0), Point2<double>(2, 2) };
+    EXPECT_TRUE(std::any_of(axes.begin(), axes.end(), [&](Axis<double>& axis) { return axis.isEqual(diagonal, 1e-12); }));
+
+    // compact axes are positions in original polygon and findSymmetry builds its axes from them
+    auto compact { finder.findSymmetryCompact(PolygonView<double>(square), 1e-8, workspace) };
+    ASSERT_EQ(compact.size(), axes.size());
+    auto built { finder.toAxes(PolygonView<double>(square), compact) };
+    for (size_t i{}; i < axes.size(); ++i) {
+        EXPECT_LT(compact[i].first, 2 * square.getNodes().size());
+        EXPECT_LT(compact[i].second, 2 * square.getNodes().size());
+        EXPECT_TRUE(built[i].isEqual(axes[i], 0));
+    }
+}
+
+TEST(SimplifierTest, MapPositionFindsMiddleOfRun) {
+    // bottom side is split into edges 1, 1, 2, middle of run is node 2
+    Polygon<double> p { std::vector<Point2<double>>{ {0, 0}, {1, 0}, {2, 0}, {4, 0}, {4, 4}, {0, 4} } };
+    PolygonSimplifier<double> simplifier{};
+    simplifier.simplify(p.getNodes(), 1e-8);
+    std::vector<size_t> expected { 0, 3, 4, 5 };
+    ASSERT_EQ(simplifier.getIndices(), expected);
+    EXPECT_EQ(simplifier.mapPosition(p.getNodes(), 0, 1e-8), 0);
+    EXPECT_EQ(simplifier.mapPosition(p.getNodes(), 2, 1e-8), 6);
+    EXPECT_EQ(simplifier.mapPosition(p.getNodes(), 1, 1e-8), 4);
+    EXPECT_EQ(simplifier.mapPosition(p.getNodes(), 3, 1e-8), 7);
+    // closing edge from node 5 to node 0
+    EXPECT_EQ(simplifier.mapPosition(p.getNodes(), 7, 1e-8), 11);
+
+    // edges 1, 2 have middle inside second edge at 1.5, it is not middle of edge
+    Polygon<double> q { std::vector<Point2<double>>{ {0, 0}, {1, 0}, {3, 0}, {3, 3}, {0, 3} } };
+    simplifier.simplify(q.getNodes(), 1e-8);
+    EXPECT_EQ(simplifier.mapPosition(q.getNodes(), 1, 1e-8), SIZE_MAX);
+}
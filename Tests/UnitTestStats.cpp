@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include "SymmetryFinder.hpp"
+#include "SymmetryStats.hpp"
+
+#include <type_traits>
+#include <vector>
+
+static Polygon<double> square() {
+    return Polygon<double>{ std::vector<Point2<double>>{ {0,0}, {1,0}, {1,1}, {0,1} } };
+}
+
+TEST(StatsTest, NoStatsHasNoSize) {
+    EXPECT_TRUE(std::is_empty_v<NoStats>);
+    EXPECT_EQ(sizeof(SymmetryFinder<double>), sizeof(SymmetryFinder<double, NoStats>));
+}
+
+TEST(StatsTest, LinearEngine) {
+    SymmetryFinder<double, SymmetryStats> finder{};
+    EXPECT_EQ(finder.findSymmetry(square(), 1e-8).size(), 4);
+
+    const auto& stats { finder.getStats() };
+    EXPECT_EQ(stats.getGenerated(), 8);
+    EXPECT_EQ(stats.getAccepted(), 4);
+    EXPECT_GT(stats.getComparisons(), 0);
+    EXPECT_GT(stats.getAllocated(), 0);
+
+    finder.resetStats();
+    EXPECT_EQ(finder.getStats().getGenerated(), 0);
+    EXPECT_EQ(finder.getStats().getTime(SymmetryPhase::Matching).count(), 0);
+}
+
+TEST(StatsTest, CandidateEngines) {
+    for (auto engine : { SymmetryEngine::Vectorized, SymmetryEngine::Reference }) {
+        SymmetryFinder<double, SymmetryStats> finder{ engine };
+        EXPECT_EQ(finder.findSymmetry(square(), 1e-8).size(), 4);
+
+        const auto& stats { finder.getStats() };
+        EXPECT_EQ(stats.getGenerated(), 8);
+        EXPECT_EQ(stats.getTested(), 8);
+        EXPECT_EQ(stats.getAccepted(), 8);
+        EXPECT_GE(stats.getComparisons(), 8 * 4);
+        EXPECT_EQ(stats.getEarlyExits(), 0);
+        EXPECT_GT(stats.getAllocated(), 0);
+
+        // scalene triangle is rejected by prefilter, Reference engine has no prefilter
+        Polygon<double> triangle { std::vector<Point2<double>>{ {0,0}, {4,0}, {1,3} } };
+        EXPECT_TRUE(finder.findSymmetry(triangle, 1e-8).empty());
+        EXPECT_EQ(finder.getStats().getEarlyExits(), engine == SymmetryEngine::Reference ? 0 : 1);
+        EXPECT_EQ(finder.getStats().getPrefilterChecked(), engine == SymmetryEngine::Reference ? 0 : 2);
+        EXPECT_EQ(finder.getStats().getPrefilterRejected(), engine == SymmetryEngine::Reference ? 0 : 1);
+        EXPECT_NE(finder.getStats().toString().find("prefilter.rejected: "), std::string::npos);
+    }
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "Point2.hpp"
+#include "SymmetryFinder.hpp"
+#include "SymmetryGroup.hpp"
+#include "EdgeAngleSequence.hpp"
+#include "CyclicMatcher.hpp"
+#include "TestHelpers.hpp"
+
+#include <cmath>
+#include <vector>
+
+// every blade is asymmetric, so polygon has only rotations
+static Polygon<double> pinwheel(size_t blades) {
+    std::vector<Point2<double>> nodes{};
+    double radii[] { 1.0, 2.0, 1.3 }, offsets[] { 0, 0.15, 0.6 };
+    for (size_t i{}; i < blades; ++i) {
+        for (size_t k{}; k < 3; ++k) {
+            double angle { 2 * std::acos(-1) * i / blades + offsets[k] };
+            nodes.push_back(Point2<double>(radii[k] * std::cos(angle), radii[k] * std::sin(angle)));
+        }
+    }
+    return Polygon<double>{ nodes };
+}
+
+TEST(SymmetryGroupTest, RegularPolygons) {
+    SymmetryFinder<double> finder{};
+    for (size_t size : { 3, 4, 7, 12, 100000 }) {
+        auto group { finder.findSymmetryGroup(regularPolygon(size, 5), 1e-8) };
+        EXPECT_EQ(group.rotationOrder, size);
+        EXPECT_EQ(group.axes.size(), size);
+        EXPECT_EQ(group.getOrder(), 2 * size);
+        EXPECT_TRUE(group.isDihedral());
+    }
+}
+
+TEST(SymmetryGroupTest, Pinwheels) {
+    SymmetryFinder<double> finder{};
+    for (size_t blades : { 2, 3, 5, 8 }) {
+        auto poly { pinwheel(blades) };
+        auto group { finder.findSymmetryGroup(poly, 1e-8) };
+        EXPECT_EQ(group.rotationOrder, blades);
+        EXPECT_TRUE(group.axes.empty());
+        EXPECT_TRUE(finder.findSymmetry(poly, 1e-8).empty());
+    }
+}
+
+TEST(SymmetryGroupTest, PinwheelWithNearMissMirrorTokens) {
+    // outer node of every blade is turned by 1.5e-8 from middle between inner nodes: tokens of
+    // mirror are equal with presision 1e-8, but reflected nodes are farther than 1e-8 from their mirrors
+    double pi { std::acos(-1) };
+    std::vector<Point2<double>> nodes{};
+    for (size_t i{}; i < 50; ++i) {
+        double angle { 2 * pi * i / 50 }, outer { angle + pi / 50 + 1.5e-8 };
+        nodes.push_back(Point2<double>(std::cos(angle), std::sin(angle)));
+        nodes.push_back(Point2<double>(1.5 * std::cos(outer), 1.5 * std::sin(outer)));
+    }
+    Polygon<double> poly { nodes };
+
+    EdgeAngleSequence<double> sequence { nodes };
+    std::vector<SequenceToken<double>> reversed{};
+    sequence.getReversed(reversed);
+    auto equal = [](const SequenceToken<double>& a, const SequenceToken<double>& b) { return a.isEqual(b, 1e-8); };
+    ASSERT_EQ(findCyclicShifts(sequence.getTokens(), reversed, equal).size(), 50);
+
+    SymmetryFinder<double> finder{};
+    auto group { finder.findSymmetryGroup(poly, 1e-8) };
+    EXPECT_TRUE(group.axes.empty());
+    EXPECT_EQ(group.rotationOrder, 50);
+}
+
+TEST(SymmetryGroupTest, RectangleAndAsymmetric) {
+    SymmetryFinder<double> finder{};
+    Polygon<double> rectangle { std::vector<Point2<double>>{ {0,0}, {3,0}, {3,1}, {0,1} } };
+    auto group { finder.findSymmetryGroup(rectangle, 1e-8) };
+    EXPECT_EQ(group.rotationOrder, 2);
+    EXPECT_EQ(group.axes.size(), 2);
+
+    Polygon<double> triangle { std::vector<Point2<double>>{ {0,0}, {4,0}, {1,3} } };
+    group = finder.findSymmetryGroup(triangle, 1e-8);
+    EXPECT_EQ(group.rotationOrder, 1);
+    EXPECT_TRUE(group.axes.empty());
+    EXPECT_EQ(group.getOrder(), 1);
+
+    PolygonView<double> view { rectangle };
+    EXPECT_EQ(finder.findSymmetryGroup(view, 1e-8).rotationOrder, 2);
+}
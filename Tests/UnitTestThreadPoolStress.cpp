@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "SymmetryFinder.hpp"
+#include "ThreadPool.hpp"
+#include "TestHelpers.hpp"
+
+#include <atomic>
+#include <vector>
+
+// many short calls make the caller return right after the last iteration while workers
+// still finish their tasks, so ThreadSanitizer sees any access to the caller frame
+TEST(ThreadPoolStressTest, ShortParallelForCalls) {
+    ThreadPool pool{ 4 };
+    for (int repeat{}; repeat < 2000; ++repeat) {
+        std::atomic<size_t> sum{};
+        pool.parallelFor(8, 1, [&](size_t i) { sum += i; });
+        ASSERT_EQ(sum, 28);
+    }
+}
+
+TEST(ThreadPoolStressTest, ShortParallelForCallsWithException) {
+    ThreadPool pool{ 4 };
+    for (int repeat{}; repeat < 500; ++repeat) {
+        EXPECT_THROW(pool.parallelFor(8, 1, [](size_t i) {
+            if (i == 7) {
+                throw std::runtime_error("error");
+            }
+        }), std::runtime_error);
+    }
+}
+
+TEST(ThreadPoolStressTest, RepeatedBatch) {
+    std::vector<Polygon<double>> polygons{};
+    for (int i{}; i < 16; ++i) {
+        polygons.push_back(regularPolygon(3 + i, 1.0 + i));
+    }
+
+    ThreadPool pool{ 4 };
+    SymmetryFinder<double> finder{};
+    finder.setThreadPool(&pool);
+    for (int repeat{}; repeat < 200; ++repeat) {
+        auto results { finder.findSymmetryBatch(polygons, 1e-6) };
+        ASSERT_EQ(results.size(), polygons.size());
+        for (size_t i{}; i < polygons.size(); ++i) {
+            ASSERT_EQ(results[i].size(), 3 + i);
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include "Polygon.hpp"
+#include "PolygonView.hpp"
+#include "Point2.hpp"
+#include "SymmetryFinder.hpp"
+#include "SymmetryWorkspace.hpp"
+#include "TestHelpers.hpp"
+
+#include <cmath>
+#include <vector>
+
+static void expectSameAxes(std::vector<Axis<double>> a, std::vector<Axis<double>> b) {
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i{}; i < a.size(); ++i) {
+        EXPECT_TRUE(a[i].isEqual(b[i], 1e-9));
+    }
+}
+
+TEST(WorkspaceTest, SameAxesAsWithoutWorkspace) {
+    for (auto engine : { SymmetryEngine::Linear, SymmetryEngine::Vectorized, SymmetryEngine::Reference }) {
+        SymmetryFinder<double> finder { engine };
+        SymmetryWorkspace<double> workspace{};
+        for (size_t size : { 3, 7, 64, 5, 100 }) {
+            auto poly { regularPolygon(size, 2.0) };
+            auto expected { finder.findSymmetry(poly, 1e-8) };
+            expectSameAxes(finder.findSymmetry(PolygonView<double>(poly), 1e-8, workspace), expected);
+            EXPECT_EQ(workspace.getAxes().size(), size);
+            EXPECT_EQ(workspace.getCompactAxes().size(), size);
+        }
+    }
+}
+
+TEST(WorkspaceTest, MemoryOnlyGrows) {
+    SymmetryFinder<double> finder { SymmetryEngine::Vectorized };
+    SymmetryWorkspace<double> workspace{};
+    finder.findSymmetry(PolygonView<double>(regularPolygon(200, 1.0)), 1e-8, workspace);
+    auto memory { workspace.getMemorySize() };
+    EXPECT_GT(memory, 0u);
+
+    finder.findSymmetry(PolygonView<double>(regularPolygon(10, 1.0)), 1e-8, workspace);
+    EXPECT_EQ(workspace.getMemorySize(), memory);
+}